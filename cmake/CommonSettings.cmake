@@ -9,6 +9,9 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR CMAKE_CXX_COMPILER_ID STREQUAL "Clang
     add_compile_options(-Wall -Wextra -Wpedantic)
 endif()
 
+# Benchmark executables (bench/ in each component), off by default
+option(BUILD_BENCHMARKS "Build the benchmark executables." OFF)
+
 # Testing configuration
 option(BUILD_TESTING "Build the testing tree." ON)
 if(BUILD_TESTING)
@@ -0,0 +1,82 @@
+// Many independent games per call: BatchSearcher against one searchBestMove
+// call per game, on random 3x3 positions and random 5x5 (4 in a row)
+// openings searched to a fixed depth.
+// Usage: bench_batch_search [5x5 games] [depth] [threads]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "BatchSearch.h"
+
+namespace {
+
+template <typename BoardT>
+void randomGames(size_t count, int plies, std::vector<BoardT>& boards, std::vector<Player>& players) {
+    std::mt19937 rng(42);
+    while (boards.size() < count) {
+        BoardT board;
+        Player p = Player::X;
+        for (int ply = 0; ply < plies && !board.isGameOver(); ++ply) {
+            std::vector<int> cells;
+            for (int cell : board.emptyCells()) cells.push_back(cell);
+            board.makeMove(cells[rng() % cells.size()], p);
+            p = otherPlayer(p);
+        }
+        if (board.isGameOver()) continue;
+        boards.push_back(board);
+        players.push_back(p);
+    }
+}
+
+template <typename Fn>
+double seconds(Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+void report(const char* label, size_t games, double elapsed) {
+    std::printf("%-36s %10.3f s  %12.0f games/s\n", label, elapsed, games / elapsed);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t games = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 200;
+    int depth = (argc > 2) ? std::atoi(argv[2]) : 4;
+    unsigned threads = (argc > 3) ? std::strtoul(argv[3], nullptr, 10) : 0;
+
+    std::vector<Board> small;
+    std::vector<Player> smallPlayers;
+    randomGames(100000, 3, small, smallPlayers);
+    std::vector<std::pair<int, int>> smallMoves(small.size());
+    report("3x3 findBestMove per game", small.size(), seconds([&] {
+        for (size_t i = 0; i < small.size(); ++i) smallMoves[i] = findBestMove(small[i], smallPlayers[i]);
+    }));
+    report("3x3 findBestMoves", small.size(), seconds([&] {
+        findBestMoves(small.data(), smallPlayers.data(), smallMoves.data(), small.size());
+    }));
+
+    std::vector<BasicBoard<5, 4>> large;
+    std::vector<Player> largePlayers;
+    randomGames(games, 4, large, largePlayers);
+    std::vector<std::pair<int, int>> largeMoves(large.size());
+    SearchOptions options;
+    options.engine = Engine::Negamax;
+    options.maxDepth = depth;
+    options.threads = threads;
+    report("5x5 searchBestMove per game", large.size(), seconds([&] {
+        for (size_t i = 0; i < large.size(); ++i)
+            largeMoves[i] = searchBestMove(large[i], largePlayers[i], options).move;
+    }));
+    BatchSearcher<BasicBoard<5, 4>> searcher(options);
+    report("5x5 BatchSearcher, first call", large.size(), seconds([&] {
+        searcher.findBestMoves(large.data(), largePlayers.data(), largeMoves.data(), large.size());
+    }));
+    report("5x5 BatchSearcher, next tick", large.size(), seconds([&] {
+        searcher.findBestMoves(large.data(), largePlayers.data(), largeMoves.data(), large.size());
+    }));
+    return 0;
+}
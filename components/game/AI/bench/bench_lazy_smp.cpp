@@ -0,0 +1,36 @@
+// Lazy SMP nodes per second by thread count on a 5x5 board (4 in a row).
+// Usage: bench_lazy_smp [max threads] [depth]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include "Engine.h"
+
+int main(int argc, char** argv) {
+    unsigned maxThreads = (argc > 1) ? std::strtoul(argv[1], nullptr, 10)
+                                     : std::max(1u, std::thread::hardware_concurrency());
+    int depth = (argc > 2) ? std::atoi(argv[2]) : 7;
+
+    BasicBoard<5, 4> board;
+    board.makeMove(2, 2, Player::X);
+    board.makeMove(1, 1, Player::O);
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        SearchOptions options;
+        options.engine = Engine::LazySmp;
+        options.threads = threads;
+        options.maxDepth = depth;
+        auto start = std::chrono::steady_clock::now();
+        SearchResult result = searchBestMove(board, Player::X, options);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        double total = 0;
+        for (const ThreadStats& stats : result.threads) total += stats.nodesPerSecond();
+        char label[64];
+        std::snprintf(label, sizeof(label), "lazy smp, %u threads", threads);
+        std::printf("%-36s %10.3f s  %10.1f M nodes/s  %8.1f M/s per thread  move (%d,%d)\n",
+                    label, elapsed.count(), total / 1e6, total / threads / 1e6,
+                    result.move.first, result.move.second);
+    }
+    return 0;
+}
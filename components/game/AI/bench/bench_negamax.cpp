@@ -0,0 +1,94 @@
+// Nodes visited by findBestMove's alpha-beta against the PVS negamax with
+// aspiration windows, with and without move ordering, all searching to the
+// end of the game.
+// Usage: bench_negamax
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include "Engine.h"
+
+namespace {
+
+// board that counts the moves played on it, i.e. the nodes minimax visits
+template <typename BoardT>
+class CountingBoard : public BoardT {
+public:
+    bool makeMove(int cell, Player p) {
+        ++nodes;
+        return BoardT::makeMove(cell, p);
+    }
+    uint64_t nodes = 0;
+};
+
+// findBestMove's root loop over a counting board
+template <typename BoardT>
+uint64_t minimaxNodes(const BoardT& board, Player toMove, bool withTable) {
+    CountingBoard<BoardT> work;
+    static_cast<BoardT&>(work) = board;
+    TranspositionTable table;
+    for (int cell : board.emptyCells()) {
+        work.makeMove(cell, toMove);
+        minimax(work, otherPlayer(toMove), toMove, std::numeric_limits<int>::min(),
+                std::numeric_limits<int>::max(), 0, withTable ? &table : nullptr);
+        work.undoMove();
+    }
+    return work.nodes + 1;
+}
+
+template <typename BoardT>
+void compare(const char* name, const BoardT& board, Player toMove, bool plainMinimax) {
+    auto start = std::chrono::steady_clock::now();
+    uint64_t plain = plainMinimax ? minimaxNodes(board, toMove, false) : 0;
+    uint64_t cached = minimaxNodes(board, toMove, true);
+    std::chrono::duration<double> minimaxTime = std::chrono::steady_clock::now() - start;
+
+    SearchOptions options;
+    options.engine = Engine::Negamax;
+    options.tableEntries = size_t(1) << 16;  // same size as the minimax table
+    options.moveOrdering = false;
+    start = std::chrono::steady_clock::now();
+    SearchResult unordered = searchBestMove(board, toMove, options);
+    std::chrono::duration<double> unorderedTime = std::chrono::steady_clock::now() - start;
+
+    options.moveOrdering = true;
+    start = std::chrono::steady_clock::now();
+    SearchResult result = searchBestMove(board, toMove, options);
+    std::chrono::duration<double> negamaxTime = std::chrono::steady_clock::now() - start;
+
+    std::printf("%s\n", name);
+    if (plainMinimax)
+        std::printf("  %-34s %12llu nodes\n", "alpha-beta", static_cast<unsigned long long>(plain));
+    std::printf("  %-34s %12llu nodes  %8.3f s\n", "alpha-beta + table",
+                static_cast<unsigned long long>(cached), minimaxTime.count());
+    auto report = [cached](const char* label, const SearchResult& r, double seconds) {
+        const ThreadStats& stats = r.threads[0];
+        std::printf("  %-34s %12llu nodes  %8.3f s  (%+.1f%% nodes vs alpha-beta + table,"
+                    " %.0f%% of cut-offs on the first move)\n",
+                    label, static_cast<unsigned long long>(stats.nodes), seconds,
+                    100.0 * (double(stats.nodes) / double(cached) - 1.0),
+                    stats.cutoffs ? 100.0 * stats.firstMoveCutoffs / stats.cutoffs : 0.0);
+    };
+    report("pvs + aspiration, cell order", unordered, unorderedTime.count());
+    report("pvs + aspiration, move ordering", result, negamaxTime.count());
+}
+
+} // namespace
+
+int main() {
+    Board empty;
+    compare("3x3, empty board", empty, Player::X, true);
+
+    Board corner;
+    corner.makeMove(0, 0, Player::X);
+    compare("3x3, X in a corner", corner, Player::O, true);
+
+    BasicBoard<4, 3> small;
+    small.makeMove(1, 1, Player::X);
+    small.makeMove(2, 2, Player::O);
+    compare("4x4 (3 in a row), two moves in", small, Player::X, false);
+
+    BasicBoard<4, 4> open;
+    open.makeMove(1, 1, Player::X);
+    compare("4x4 (4 in a row), one move in", open, Player::O, false);
+    return 0;
+}
@@ -0,0 +1,32 @@
+// Tree-parallel MCTS playouts per second from 1 to 32 threads on one move
+// of a 7x7 board (5 in a row).
+// Usage: bench_parallel_mcts [playouts] [max threads]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "ParallelMcts.h"
+
+int main(int argc, char** argv) {
+    int playouts = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    unsigned maxThreads = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 32;
+
+    BasicBoard<7, 5> board;
+    board.makeMove(3, 3, Player::X);
+    MctsOptions options;
+    options.iterations = playouts;
+
+    double base = 0;
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        ParallelMcts<BasicBoard<7, 5>> mcts(options, threads);
+        auto start = std::chrono::steady_clock::now();
+        MctsResult result = mcts.search(board, Player::O);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        double rate = result.iterations / elapsed.count();
+        if (threads == 1) base = rate;
+        char label[64];
+        std::snprintf(label, sizeof(label), "tree parallel, %u threads", threads);
+        std::printf("%-36s %10.1f K playouts/s  x%.2f  move (%d,%d)\n", label, rate / 1e3,
+                    rate / base, result.cell / 7, result.cell % 7);
+    }
+    return 0;
+}
@@ -0,0 +1,34 @@
+// Root-split search time on a 4x4 board (4 in a row) by worker count.
+// Usage: bench_parallel_search [max threads]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include "ParallelSearch.h"
+
+int main(int argc, char** argv) {
+    unsigned maxThreads = (argc > 1) ? std::strtoul(argv[1], nullptr, 10)
+                                     : std::max(1u, std::thread::hardware_concurrency());
+
+    // 4 in a row on 4x4 after X's opening move
+    BasicBoard<4, 4> board;
+    board.makeMove(1, 1, Player::X);
+
+    auto start = std::chrono::steady_clock::now();
+    TranspositionTable table;
+    auto serial = findBestMove(board, Player::O, &table);
+    std::chrono::duration<double> base = std::chrono::steady_clock::now() - start;
+    std::printf("%-36s %10.3f s   move (%d,%d)\n", "serial", base.count(), serial.first, serial.second);
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        ThreadPool pool(threads);
+        start = std::chrono::steady_clock::now();
+        auto move = findBestMoveParallel(board, Player::O, pool);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        char label[64];
+        std::snprintf(label, sizeof(label), "root split, %u threads", threads);
+        std::printf("%-36s %10.3f s   move (%d,%d)  x%.2f\n", label, elapsed.count(),
+                    move.first, move.second, base.count() / elapsed.count());
+    }
+    return 0;
+}
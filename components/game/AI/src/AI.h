@@ -2,12 +2,212 @@
 #define AI_H
 
 #include "Board.h"
+#include "BasicBoard.h"
+#include "TranspositionTable.h"
 #include <utility>
+#include <vector>
+#include <limits>
+#include <algorithm>
 
 Player otherPlayer(Player p);
 
-int minimax(Board board, Player currentPlayer, Player aiPlayer, int alpha, int beta, int depth);
+// Search works on any board with Board's interface (Board, BasicBoard<N, K>).
+// Scores are (CELLS + 1) - depth for a win, the negation for a loss and 0 for
+// a draw, which gives the classic +-10 on 3x3.
 
+// Minimax with Alpha-Beta Pruning
+// (plays and takes back moves on the given board, which is left unchanged).
+// With a table, results are cached per position and the cached best move is
+// searched first.
+template <typename BoardT>
+int minimax(BoardT& board, Player currentPlayer, Player aiPlayer, int alpha, int beta, int depth,
+            TranspositionTable* table = nullptr) {
+    constexpr int WIN_SCORE = BoardT::CELLS + 1;
+
+    // Base case: game is over
+    if (board.isGameOver()) {
+        Player winner = board.winner();
+        if (winner == aiPlayer) return WIN_SCORE - depth;      // AI wins (prefer faster wins)
+        else if (winner != Player::None) return -WIN_SCORE + depth; // Opponent wins (prefer slower losses)
+        else return 0;                                          // Draw
+    }
+
+    // table scores are from the side to move and count plies from this node,
+    // so one entry serves every aiPlayer and every depth
+    bool aiToMove = (currentPlayer == aiPlayer);
+    uint64_t key = 0;
+    int tableMove = -1;
+    if (table) {
+        key = TranspositionTable::keyFor(board.hash(), currentPlayer);
+        TTEntry entry;
+        if (table->probe(key, entry)) {
+            int score = entry.score > 0 ? entry.score - depth : entry.score < 0 ? entry.score + depth : 0;
+            Bound bound = entry.bound;
+            // a bound left by a narrow window need not be a reachable score,
+            // and the shift can carry it across 0; no real score lies
+            // between, so 0 is still a valid bound there
+            if (bound != Bound::Exact && ((entry.score > 0 && score < 0) || (entry.score < 0 && score > 0)))
+                score = 0;
+            if (!aiToMove) {
+                score = -score;
+                if (bound != Bound::Exact) bound = (bound == Bound::Lower) ? Bound::Upper : Bound::Lower;
+            }
+            if (bound == Bound::Exact) return score;
+            if (bound == Bound::Lower) alpha = std::max(alpha, score);
+            else beta = std::min(beta, score);
+            if (beta <= alpha) return score;
+            tableMove = entry.bestMove;
+        }
+    }
+
+    int bestCell = -1;
+    auto searchChild = [&](int cell) {
+        board.makeMove(cell, currentPlayer);
+        int eval = minimax(board, otherPlayer(currentPlayer), aiPlayer, alpha, beta, depth + 1, table);
+        board.undoMove();
+        if (aiToMove) {
+            // Maximizing player (AI)
+            if (eval > alpha) {
+                alpha = eval;
+                bestCell = cell;
+            }
+        } else {
+            // Minimizing player (opponent)
+            if (eval < beta) {
+                beta = eval;
+                bestCell = cell;
+            }
+        }
+        return beta <= alpha;  // cut-off
+    };
+
+    int windowAlpha = alpha;
+    int windowBeta = beta;
+    auto moves = board.emptyCells();
+    bool cutOff = tableMove >= 0 && moves.test(tableMove) && searchChild(tableMove);
+    if (!cutOff) {
+        for (int cell : moves) {
+            if (cell != tableMove && searchChild(cell)) break;
+        }
+    }
+    int result = aiToMove ? alpha : beta;
+
+    if (table) {
+        Bound bound = result <= windowAlpha ? Bound::Upper
+                    : result >= windowBeta ? Bound::Lower
+                    : Bound::Exact;
+        int score = result;
+        if (!aiToMove) {
+            score = -score;
+            if (bound != Bound::Exact) bound = (bound == Bound::Lower) ? Bound::Upper : Bound::Lower;
+        }
+        score = score > 0 ? score + depth : score < 0 ? score - depth : 0;
+        table->store(key, score, bound, bestCell);
+    }
+    return result;
+}
+
+// Find the best move for the AI
+// (pass the same table on every call of a game to reuse earlier searches)
+template <typename BoardT>
+std::pair<int, int> findBestMove(const BoardT& board, Player aiPlayer, TranspositionTable* table = nullptr) {
+    constexpr int N = BoardT::SIZE;
+
+    // If board is empty, take center
+    if (board.moveCount() == 0) {
+        return {N / 2, N / 2};  // Return center position
+    }
+
+    int bestScore = std::numeric_limits<int>::min();
+    std::pair<int, int> bestMove = {-1, -1};
+    BoardT work = board;  // single scratch board, searched in place
+
+    // Check for immediate winning move first
+    for (int cell : board.emptyCells()) {
+        work.makeMove(cell, aiPlayer);
+        bool wins = work.winner() == aiPlayer;
+        work.undoMove();
+        if (wins) {
+            return {cell / N, cell % N};  // Return immediate winning move
+        }
+    }
+
+    // If no immediate win, perform minimax search
+    for (int cell : board.emptyCells()) {
+        work.makeMove(cell, aiPlayer);
+        int score = minimax(work, otherPlayer(aiPlayer), aiPlayer,
+                           std::numeric_limits<int>::min(), // Start alpha very small (-infinity)
+                           std::numeric_limits<int>::max(), // Start beta very large (infinity)
+                           0,  // Start depth at 0
+                           table);
+        work.undoMove();
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = {cell / N, cell % N};
+        }
+    }
+    return bestMove;
+}
+
+enum class Outcome { Win, Draw, Loss };
+
+// exact value of one legal move for the player making it
+struct MoveAnalysis {
+    int row;
+    int col;
+    int score;        // minimax scale: > 0 win, 0 draw, < 0 loss, larger is faster
+    Outcome outcome;
+    int plies;        // moves until the game ends under perfect play, this one included
+};
+
+// outcome and distance for a root score, on a board `size` wide with
+// emptyCells empty cells before the move
+template <int Cells>
+MoveAnalysis describeMove(int cell, int size, int score, int emptyCells) {
+    constexpr int WIN_SCORE = Cells + 1;
+    MoveAnalysis move = { cell / size, cell % size, score, Outcome::Draw, emptyCells };
+    if (score > 0) {
+        move.outcome = Outcome::Win;
+        move.plies = WIN_SCORE + 1 - score;
+    } else if (score < 0) {
+        move.outcome = Outcome::Loss;
+        move.plies = WIN_SCORE + 1 + score;
+    }
+    return move;
+}
+
+// Value of every legal move for `player`, in cell order, from one search
+// sharing a single table (a private one unless `table` is given). Empty once
+// the game is over.
+template <typename BoardT>
+std::vector<MoveAnalysis> analyzePosition(const BoardT& board, Player player,
+                                          TranspositionTable* table = nullptr) {
+    std::vector<MoveAnalysis> moves;
+    if (board.isGameOver()) return moves;
+
+    TranspositionTable ownTable;
+    if (!table) table = &ownTable;
+    int emptyCount = BoardT::CELLS - board.moveCount();
+    BoardT work = board;
+    for (int cell : board.emptyCells()) {
+        work.makeMove(cell, player);
+        int score = minimax(work, otherPlayer(player), player,
+                            std::numeric_limits<int>::min(),
+                            std::numeric_limits<int>::max(), 0, table);
+        work.undoMove();
+        moves.push_back(describeMove<BoardT::CELLS>(cell, BoardT::SIZE, score, emptyCount));
+    }
+    return moves;
+}
+
+// 3x3: perfect play straight from the generated table (see Tablebase.h), O(1).
+// Defined in Tablebase.cpp.
+// Picks the same moves as the search, breaking ties center-first.
 std::pair<int, int> findBestMove(const Board& board, Player aiPlayer);
 
+// the 3x3 search is compiled once, in AI.cpp
+extern template int minimax<Board>(Board&, Player, Player, int, int, int, TranspositionTable*);
+extern template std::pair<int, int> findBestMove<Board>(const Board&, Player, TranspositionTable*);
+extern template std::vector<MoveAnalysis> analyzePosition<Board>(const Board&, Player, TranspositionTable*);
+
 #endif
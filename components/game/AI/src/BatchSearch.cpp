@@ -0,0 +1,7 @@
+#include "BatchSearch.h"
+
+void findBestMoves(const Board* boards, const Player* players, std::pair<int, int>* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) out[i] = findBestMove(boards[i], players[i]);
+}
+
+template class BatchSearcher<Board>;
@@ -0,0 +1,87 @@
+#ifndef BATCH_SEARCH_H
+#define BATCH_SEARCH_H
+
+#include "Engine.h"
+#include "SharedTranspositionTable.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Best moves for many independent games in one call, e.g. once per server
+// tick for every game waiting on the AI. The pool and the shared table are
+// made once and kept between calls, so a call does no setup, and positions
+// searched before (in any game, in any call) start from their table
+// entries. Threads take positions from a shared counter, so long searches
+// don't leave the others idle; the calling thread works too.
+// 3x3 boards are answered from the tablebase. Other boards get a
+// single-threaded negamax each, with options.maxDepth, moveOrdering,
+// timeLimit and nodeBudget applying per position. options.threads sizes
+// the pool (0 = one per hardware thread) and options.engine is ignored.
+template <typename BoardT>
+class BatchSearcher {
+public:
+    explicit BatchSearcher(const SearchOptions& options = {})
+        : pool(options.threads), table(IS_3X3 ? 1 : options.tableEntries) {
+        negamax.maxDepth = options.maxDepth;
+        negamax.moveOrdering = options.moveOrdering;
+        negamax.timeLimit = options.timeLimit;
+        negamax.nodeBudget = options.nodeBudget;
+    }
+
+    // out[i] = best move for boards[i] with players[i] to move, {-1, -1}
+    // if that game is over. The arrays must not overlap.
+    void findBestMoves(const BoardT* boards, const Player* players, std::pair<int, int>* out, size_t count) {
+        if (count == 0) return;
+        // tablebase lookups are cheap, so hand them out a block at a time
+        constexpr size_t BLOCK = IS_3X3 ? 4096 : 1;
+        std::atomic<size_t> next(0);
+        auto run = [&] {
+            for (;;) {
+                size_t first = next.fetch_add(BLOCK, std::memory_order_relaxed);
+                if (first >= count) return;
+                size_t last = std::min(count, first + BLOCK);
+                for (size_t i = first; i < last; ++i) out[i] = bestMove(boards[i], players[i]);
+            }
+        };
+
+        size_t helpers = std::min<size_t>(pool.size(), (count + BLOCK - 1) / BLOCK) - 1;
+        std::vector<std::future<void>> pending;
+        pending.reserve(helpers);
+        for (size_t i = 0; i < helpers; ++i) pending.push_back(pool.submit(run));
+        run();
+        for (std::future<void>& done : pending) done.get();
+    }
+
+    // forget every searched position, e.g. after changing the evaluation
+    void clearCache() { table.clear(); }
+
+private:
+    static constexpr bool IS_3X3 = std::is_same_v<BoardT, Board>;
+
+    std::pair<int, int> bestMove(const BoardT& board, Player toMove) {
+        if constexpr (IS_3X3) {
+            return findBestMove(board, toMove);
+        } else {
+            LazySmpResult result = lazySmpSearch(board, toMove, negamax, table);
+            if (result.cell < 0) return {-1, -1};
+            return {result.cell / BoardT::SIZE, result.cell % BoardT::SIZE};
+        }
+    }
+
+    NegamaxOptions negamax;
+    ThreadPool pool;
+    SharedTranspositionTable table;
+};
+
+// Tablebase moves for many 3x3 games on the calling thread: a lookup is
+// a few nanoseconds, so below millions of games threads don't pay off.
+void findBestMoves(const Board* boards, const Player* players, std::pair<int, int>* out, size_t count);
+
+extern template class BatchSearcher<Board>;
+
+#endif // BATCH_SEARCH_H
@@ -0,0 +1,3 @@
+#include "Engine.h"
+
+template SearchResult searchBestMove<Board>(const Board&, Player, const SearchOptions&);
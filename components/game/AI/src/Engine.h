@@ -0,0 +1,175 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "AI.h"
+#include "Mcts.h"
+#include "ParallelMcts.h"
+#include "Negamax.h"
+#include "SearchControl.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+// which search picks the move
+enum class Engine {
+    Minimax,  // exhaustive alpha-beta (the 3x3 tablebase for Board), single thread
+    Negamax,  // depth-limited negamax with PVS and aspiration windows, single thread
+    LazySmp,  // the same negamax on several threads sharing one table
+    Mcts      // Monte Carlo tree search, for boards too big to search deeply
+};
+
+struct SearchOptions {
+    Engine engine = Engine::Minimax;
+    unsigned threads = 0;                   // LazySmp: 0 = one per hardware thread;
+                                            // Mcts: above 1 searches one tree in parallel
+    int maxDepth = 0;                       // Negamax, LazySmp: plies to look ahead, 0 = to the end
+    size_t tableEntries = size_t(1) << 20;  // Negamax, LazySmp: size of the per-call table
+    SharedTranspositionTable* table = nullptr;  // Negamax, LazySmp: caller's table, kept across moves;
+                                                // null = a fresh table for this call only
+    bool moveOrdering = true;               // Negamax, LazySmp: killers, history, priors
+    std::chrono::milliseconds timeLimit{0}; // Negamax, LazySmp: deadline for deepening, 0 = none
+    uint64_t nodeBudget = 0;                // Negamax, LazySmp: main-thread nodes, 0 = none
+    int playouts = 20000;                   // Mcts: playouts per move (time limit applies too)
+    int leafPlayouts = 1;                   // Mcts: random games per new leaf
+    uint64_t seed = ZOBRIST_SEED;           // Mcts: random seed
+    MctsEngine* mcts = nullptr;             // Mcts: caller's Mcts<BoardT> or ParallelMcts<BoardT>,
+                                            // kept across moves so its node pool is reused;
+                                            // null (or another board type) = a fresh engine per call
+    SearchControl* control = nullptr;       // optional: cancel from another thread, report progress
+                                            // (Minimax only checks it before starting)
+};
+
+struct SearchResult {
+    std::pair<int, int> move = {-1, -1};
+    int score = 0;                     // negamax engines: negamax scale, from aiPlayer
+    int depth = 0;                     // plies searched (to the end for Minimax)
+    bool timedOut = false;             // the time limit cut the search short
+    bool outOfNodes = false;           // the node budget did
+    bool cancelled = false;            // options.control was cancelled; the move may be {-1, -1}
+    std::vector<ThreadStats> threads;  // negamax engines and Mcts: nodes (playouts) and time
+};
+
+// Find the best move with the chosen engine
+template <typename BoardT>
+SearchResult searchBestMove(const BoardT& board, Player aiPlayer, const SearchOptions& options = {}) {
+    constexpr int N = BoardT::SIZE;
+    SearchResult result;
+    if (options.control && options.control->isCancelled()) {
+        result.cancelled = true;
+        return result;
+    }
+    if (options.engine == Engine::Minimax) {
+        result.move = findBestMove(board, aiPlayer);
+        result.depth = BoardT::CELLS - board.moveCount();
+        return result;
+    }
+    if (options.engine == Engine::Mcts) {
+        MctsOptions mctsOptions;
+        mctsOptions.iterations = options.playouts;
+        mctsOptions.leafPlayouts = options.leafPlayouts;
+        mctsOptions.seed = options.seed;
+        mctsOptions.timeLimit = options.timeLimit;
+        mctsOptions.control = options.control;
+        auto start = std::chrono::steady_clock::now();
+        MctsResult mcts;
+        if (auto* parallel = dynamic_cast<ParallelMcts<BoardT>*>(options.mcts)) {
+            parallel->setOptions(mctsOptions, options.threads ? options.threads : parallel->threadCount());
+            mcts = parallel->search(board, aiPlayer);
+        } else if (auto* serial = dynamic_cast<Mcts<BoardT>*>(options.mcts)) {
+            serial->setOptions(mctsOptions);
+            mcts = serial->search(board, aiPlayer);
+        } else if (options.threads > 1) {
+            mcts = ParallelMcts<BoardT>(mctsOptions, options.threads).search(board, aiPlayer);
+        } else {
+            mcts = Mcts<BoardT>(mctsOptions).search(board, aiPlayer);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (mcts.cell >= 0) result.move = {mcts.cell / N, mcts.cell % N};
+        result.cancelled = mcts.cancelled;
+        result.timedOut = mcts.timedOut;
+        result.threads.resize(1);
+        result.threads[0].nodes = static_cast<uint64_t>(mcts.iterations);
+        result.threads[0].seconds = elapsed.count();
+        return result;
+    }
+
+    NegamaxOptions negamax;
+    if (options.engine == Engine::LazySmp)
+        negamax.threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    negamax.maxDepth = options.maxDepth;
+    negamax.moveOrdering = options.moveOrdering;
+    negamax.timeLimit = options.timeLimit;
+    negamax.nodeBudget = options.nodeBudget;
+    negamax.control = options.control;
+    // a fresh table costs an allocation and a clear per call; 3x3 has
+    // under 6000 positions, so it never needs the default million slots
+    std::optional<SharedTranspositionTable> ownTable;
+    if (!options.table) {
+        size_t entries = std::is_same_v<BoardT, Board> ? std::min(options.tableEntries, size_t(1) << 13)
+                                                       : options.tableEntries;
+        ownTable.emplace(entries);
+    }
+    LazySmpResult smp = lazySmpSearch(board, aiPlayer, negamax, options.table ? *options.table : *ownTable);
+    if (smp.cell >= 0) result.move = {smp.cell / N, smp.cell % N};
+    result.score = smp.score;
+    result.depth = smp.depth;
+    result.timedOut = smp.timedOut;
+    result.outOfNodes = smp.outOfNodes;
+    result.cancelled = smp.cancelled;
+    result.threads = std::move(smp.threads);
+    return result;
+}
+
+// Iterative deepening that answers within `timeLimit` (give or take the
+// time of one depth-1 search): the move from the deepest completed depth,
+// with result.depth saying how deep that was. Pass a table kept for the
+// whole game to reuse the previous moves' work.
+template <typename BoardT>
+SearchResult findBestMoveWithin(const BoardT& board, Player aiPlayer, std::chrono::milliseconds timeLimit,
+                                unsigned threads = 1, SharedTranspositionTable* table = nullptr) {
+    SearchOptions options;
+    options.table = table;
+    options.engine = threads > 1 ? Engine::LazySmp : Engine::Negamax;
+    options.threads = threads;
+    options.timeLimit = timeLimit;
+    return searchBestMove(board, aiPlayer, options);
+}
+
+// Iterative deepening that stops after about `nodeBudget` nodes (depth 1
+// always completes). Single-threaded, so the same board and budget give
+// the same move, score and depth on any machine under any load (for a
+// given table state: a fresh one unless `table` is passed).
+template <typename BoardT>
+SearchResult findBestMoveWithNodes(const BoardT& board, Player aiPlayer, uint64_t nodeBudget,
+                                   SharedTranspositionTable* table = nullptr) {
+    SearchOptions options;
+    options.table = table;
+    options.engine = Engine::Negamax;
+    options.nodeBudget = nodeBudget;
+    return searchBestMove(board, aiPlayer, options);
+}
+
+// Start searchBestMove on `pool` and return at once; the future holds the
+// result. The task works on its own copy of the board and keeps `control`
+// alive, so the caller can cancel it or poll its progress and then simply
+// drop the future (a cancelled result is not worth reading). A table in
+// options.table must outlive the search.
+template <typename BoardT>
+std::future<SearchResult> findBestMoveAsync(ThreadPool& pool, const BoardT& board, Player aiPlayer,
+                                            std::shared_ptr<SearchControl> control,
+                                            SearchOptions options = {}) {
+    return pool.submit([board, aiPlayer, control = std::move(control), options]() mutable {
+        options.control = control.get();
+        return searchBestMove(board, aiPlayer, options);
+    });
+}
+
+// the 3x3 engines are compiled once, in Engine.cpp
+extern template SearchResult searchBestMove<Board>(const Board&, Player, const SearchOptions&);
+
+#endif // ENGINE_H
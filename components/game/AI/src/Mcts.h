@@ -0,0 +1,232 @@
+#ifndef MCTS_H
+#define MCTS_H
+
+#include "AI.h"
+#include "CellMask.h"
+#include "RandomPlayouts.h"
+#include "SearchControl.h"
+#include "Zobrist.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+struct MctsOptions {
+    int iterations = 20000;        // iterations per move (one tree node each)
+    int leafPlayouts = 1;          // random games per iteration, averaged into the leaf
+    uint64_t seed = ZOBRIST_SEED;  // same seed, same board: same move
+    double exploration = 1.41;     // UCT constant, about sqrt(2)
+    std::chrono::milliseconds timeLimit{0};  // stop early after this long, 0 = no limit
+    SearchControl* control = nullptr;        // optional: cancel from another thread, report progress
+};
+
+struct MctsResult {
+    int cell = -1;        // most visited root move, -1 if the game is over
+    int iterations = 0;   // iterations actually run
+    uint32_t visits = 0;  // playouts through the chosen move
+    double winRate = 0;   // its average result for the mover: 1 win, 0.5 draw, 0 loss
+    size_t nodesUsed = 0; // tree nodes taken from the pool
+    bool cancelled = false;  // options.control stopped the search early
+    bool timedOut = false;   // options.timeLimit stopped the search early
+};
+
+namespace mcts_detail {
+
+// uniformly random set cell; splitmix64 keeps runs identical everywhere
+template <int Bits>
+int randomCell(const CellMask<Bits>& cells, uint64_t& rng) {
+    int skip = static_cast<int>(splitMix64(rng) % static_cast<uint64_t>(cells.count()));
+    for (int cell : cells)
+        if (skip-- == 0) return cell;
+    return -1;
+}
+
+// `games` random games from work with mover to play, work is left as it
+// was. Batches on the 3x3 Board go through the SIMD playout kernel.
+template <typename BoardT>
+PlayoutTally simulate(BoardT& work, Player mover, int games, uint64_t& rng) {
+    if constexpr (std::is_same_v<BoardT, Board>) {
+        if (games > 1) return randomPlayouts(work.packed(), mover, static_cast<uint64_t>(games), splitMix64(rng));
+    }
+    PlayoutTally tally;
+    for (int game = 0; game < games; ++game) {
+        int moves = 0;
+        Player p = mover;
+        while (!work.isGameOver()) {
+            work.makeMove(randomCell(work.emptyCells(), rng), p);
+            p = otherPlayer(p);
+            ++moves;
+        }
+        Player winner = work.winner();
+        ++(winner == Player::X ? tally.xWins : winner == Player::O ? tally.oWins : tally.draws);
+        for (int i = 0; i < moves; ++i) work.undoMove();
+    }
+    return tally;
+}
+
+// 2 per win and 1 per draw for `mover`
+inline uint64_t points(const PlayoutTally& tally, Player mover) {
+    return 2 * (mover == Player::X ? tally.xWins : tally.oWins) + tally.draws;
+}
+
+} // namespace mcts_detail
+
+// Common base of Mcts and ParallelMcts, so SearchOptions can carry a
+// caller's engine for any board type.
+class MctsEngine {
+public:
+    virtual ~MctsEngine() = default;
+};
+
+// Monte Carlo tree search with UCT selection and uniformly random
+// playouts (options.leafPlayouts per new leaf). Each iteration adds at most
+// one node, taken from a pool sized once for options.iterations, so
+// searching never allocates. Keep one per game and reuse it for every move;
+// setOptions changes the options without giving up the pool.
+template <typename BoardT>
+class Mcts : public MctsEngine {
+public:
+    explicit Mcts(const MctsOptions& options = {}) { setOptions(options); }
+
+    // new options for the following searches; the pool only ever grows
+    void setOptions(const MctsOptions& newOptions) {
+        options = newOptions;
+        size_t needed = static_cast<size_t>(std::max(options.iterations, 0)) + 1;
+        if (pool.size() < needed) pool.resize(needed);
+    }
+
+    MctsResult search(const BoardT& board, Player toMove) {
+        MctsResult result;
+        used = 0;
+        rngState = options.seed;
+        if (board.isGameOver()) return result;
+
+        auto start = std::chrono::steady_clock::now();
+        bool limited = options.timeLimit.count() > 0;
+        int root = newNode(-1, -1, otherPlayer(toMove), board.emptyCells());
+        BoardT work = board;
+        int path[BoardT::CELLS + 1];
+
+        int iteration = 0;
+        for (; iteration < options.iterations; ++iteration) {
+            if (limited && (iteration & 63) == 0 && iteration > 0 &&
+                std::chrono::steady_clock::now() - start >= options.timeLimit) {
+                result.timedOut = true;
+                break;
+            }
+            if (options.control) {
+                if (options.control->isCancelled()) {
+                    result.cancelled = true;
+                    break;
+                }
+                if ((iteration & 63) == 0 && iteration > 0)
+                    options.control->nodes.fetch_add(64, std::memory_order_relaxed);
+            }
+
+            // selection: follow UCT through fully expanded nodes
+            int node = root;
+            int length = 0;
+            path[length++] = node;
+            while (pool[node].untried.none() && pool[node].firstChild >= 0) {
+                node = selectChild(node);
+                work.makeMove(pool[node].move, pool[node].mover);
+                path[length++] = node;
+            }
+
+            // expansion: one random untried move, while the pool lasts
+            if (!pool[node].untried.none() && used < pool.size()) {
+                int cell = randomCell(pool[node].untried);
+                pool[node].untried.reset(cell);
+                Player mover = otherPlayer(pool[node].mover);
+                work.makeMove(cell, mover);
+                auto untried = work.isGameOver() ? CellMask<BoardT::CELLS>() : work.emptyCells();
+                node = newNode(node, cell, mover, untried);
+                path[length++] = node;
+            }
+
+            // simulation: random games to the end
+            int games = std::max(options.leafPlayouts, 1);
+            PlayoutTally tally = mcts_detail::simulate(work, otherPlayer(pool[node].mover), games, rngState);
+
+            // backpropagation: 2 for a win, 1 for a draw, from each node's mover
+            for (int i = 0; i < length; ++i) {
+                Node& n = pool[path[i]];
+                n.visits += static_cast<uint32_t>(games);
+                n.score += mcts_detail::points(tally, n.mover);
+            }
+
+            for (int i = 0; i < length - 1; ++i) work.undoMove();
+        }
+
+        // the most visited move is the most trusted one
+        int best = -1;
+        for (int child = pool[root].firstChild; child >= 0; child = pool[child].nextSibling)
+            if (best < 0 || pool[child].visits > pool[best].visits) best = child;
+        result.iterations = iteration;
+        result.nodesUsed = used;
+        if (best >= 0) {
+            result.cell = pool[best].move;
+            result.visits = pool[best].visits;
+            result.winRate = pool[best].score / (2.0 * pool[best].visits);
+        }
+        return result;
+    }
+
+private:
+    struct Node {
+        int32_t parent;
+        int32_t firstChild;
+        int32_t nextSibling;
+        int16_t move;       // cell played to reach this node
+        Player mover;       // who played it
+        uint32_t visits;
+        uint64_t score;     // 2 per win, 1 per draw, for mover
+        CellMask<BoardT::CELLS> untried;  // moves without a child yet
+    };
+
+    int newNode(int parent, int move, Player mover, const CellMask<BoardT::CELLS>& untried) {
+        int index = static_cast<int>(used++);
+        Node& node = pool[index];
+        node.parent = parent;
+        node.firstChild = -1;
+        node.nextSibling = -1;
+        node.move = static_cast<int16_t>(move);
+        node.mover = mover;
+        node.visits = 0;
+        node.score = 0;
+        node.untried = untried;
+        if (parent >= 0) {
+            node.nextSibling = pool[parent].firstChild;
+            pool[parent].firstChild = index;
+        }
+        return index;
+    }
+
+    // child with the best upper confidence bound for the player choosing
+    int selectChild(int parent) const {
+        double logVisits = std::log(static_cast<double>(pool[parent].visits));
+        int best = -1;
+        double bestValue = -1;
+        for (int child = pool[parent].firstChild; child >= 0; child = pool[child].nextSibling) {
+            const Node& n = pool[child];
+            double value = n.score / (2.0 * n.visits) + options.exploration * std::sqrt(logVisits / n.visits);
+            if (value > bestValue) {
+                bestValue = value;
+                best = child;
+            }
+        }
+        return best;
+    }
+
+    int randomCell(const CellMask<BoardT::CELLS>& cells) {
+        return mcts_detail::randomCell(cells, rngState);
+    }
+
+    MctsOptions options;
+    uint64_t rngState = 0;
+    std::vector<Node> pool;
+    size_t used = 0;
+};
+
+#endif // MCTS_H
@@ -0,0 +1,359 @@
+#ifndef NEGAMAX_H
+#define NEGAMAX_H
+
+#include "AI.h"
+#include "SearchControl.h"
+#include "SharedTranspositionTable.h"
+#include <atomic>
+#include <limits>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Depth-limited negamax for boards too large to search to the end.
+// Scores are from the side to move: MATE_SCORE - ply for a win, the
+// negation for a loss, 0 for a draw, and a line-count heuristic (always
+// inside +-MATE_BOUND) where the depth runs out.
+constexpr int MATE_SCORE = 1000000000;
+constexpr int MATE_BOUND = MATE_SCORE - 1024;  // beyond this: forced win or loss
+constexpr int INFINITE_SCORE = MATE_SCORE + 1;
+constexpr int ASPIRATION_WINDOW = 16;  // first half-width around the last score
+
+// lines only one side has pieces on are worth 4^pieces to that side
+template <typename BoardT>
+int evaluate(const BoardT& board, Player toMove) {
+    Player opponent = otherPlayer(toMove);
+    int score = 0;
+    for (int line = 0; line < BoardT::LINES; ++line) {
+        int mine = board.lineCount(toMove, line);
+        int theirs = board.lineCount(opponent, line);
+        if (theirs == 0 && mine > 0) score += 1 << (2 * std::min(mine, 7));
+        else if (mine == 0 && theirs > 0) score -= 1 << (2 * std::min(theirs, 7));
+    }
+    return score;
+}
+
+// winning lines of an N x N, K in a row board that pass through (row, col)
+constexpr int linesThroughCell(int n, int k, int row, int col) {
+    // windows of k cells on a line of `length` cells that hold position `along`
+    auto windows = [k](int along, int length) {
+        int first = std::max(0, along - k + 1);
+        int last = std::min(along, length - k);
+        return last >= first ? last - first + 1 : 0;
+    };
+    int diagOffset = row > col ? row - col : col - row;
+    int antiOffset = row + col > n - 1 ? row + col - (n - 1) : (n - 1) - (row + col);
+    return windows(col, n) + windows(row, n) +
+           windows(std::min(row, col), n - diagOffset) +
+           windows(std::min(row, n - 1 - col), n - antiOffset);
+}
+
+// per-thread search statistics
+struct ThreadStats {
+    uint64_t nodes = 0;
+    uint64_t cutoffs = 0;           // nodes that failed high
+    uint64_t firstMoveCutoffs = 0;  // ... on the first move tried (ordering quality)
+    double seconds = 0;
+    int depth = 0;  // deepest iteration completed
+
+    double nodesPerSecond() const { return seconds > 0 ? nodes / seconds : 0; }
+};
+
+struct NegamaxOptions {
+    unsigned threads = 1;
+    int maxDepth = 0;           // plies, 0 = to the end of the game
+    bool moveOrdering = true;   // priors, killers and history; off = table move, then cell order
+    std::chrono::milliseconds timeLimit{0};  // stop deepening after this long, 0 = no limit
+    uint64_t nodeBudget = 0;    // stop deepening after this many main-thread nodes, 0 = no limit
+    SearchControl* control = nullptr;  // optional: cancel from another thread, report progress
+};
+
+// One search thread: alpha-beta negamax over a shared table, stopping as
+// soon as `stop` is raised (the aborted result must then be ignored).
+template <typename BoardT>
+class SearchWorker {
+public:
+    SearchWorker(SharedTranspositionTable& table, const std::atomic<bool>& stop, bool moveOrdering = true)
+        : table(table), stop(stop), moveOrdering(moveOrdering) {
+        for (int cell = 0; cell < BoardT::CELLS; ++cell) {
+            prior[cell] = linesThroughCell(BoardT::SIZE, BoardT::WIN_LENGTH,
+                                           cell / BoardT::SIZE, cell % BoardT::SIZE);
+            history[0][cell] = history[1][cell] = 0;
+        }
+        for (auto& slots : killers) slots[0] = slots[1] = -1;
+    }
+
+    // best move at `depth` and its score within (alpha, beta); a score at or
+    // outside the window is only a bound and its move is not to be trusted.
+    // rootOffset rotates the move order so helper threads start on different
+    // subtrees. -1 if there is no move.
+    int searchRoot(BoardT& board, Player toMove, int depth, int& score, int rootOffset = 0,
+                   int alpha = -INFINITE_SCORE, int beta = INFINITE_SCORE) {
+        bestRootMove = -1;
+        score = search(board, toMove, depth, 0, alpha, beta, rootOffset);
+        return bestRootMove;
+    }
+
+    // give up (as if stopped) once the clock passes `when`
+    void setDeadline(std::chrono::steady_clock::time_point when) {
+        deadline = when;
+        hasDeadline = true;
+    }
+
+    // give up once `limit` nodes have been visited in total
+    void setNodeLimit(uint64_t limit) { nodeLimit = limit; }
+
+    // give up once control is cancelled; nodes are added to control->nodes
+    void setControl(SearchControl* searchControl) { control = searchControl; }
+
+    bool aborted() const { return wasStopped; }
+    bool outOfNodes() const { return nodeLimit != 0 && nodes >= nodeLimit; }
+    uint64_t nodes = 0;
+    uint64_t cutoffs = 0;
+    uint64_t firstMoveCutoffs = 0;
+
+private:
+    int search(BoardT& board, Player toMove, int depth, int ply, int alpha, int beta, int rootOffset = 0) {
+        // the clock is only read every DEADLINE_CHECK_NODES nodes
+        if ((++nodes & (DEADLINE_CHECK_NODES - 1)) == 0) {
+            if (hasDeadline && std::chrono::steady_clock::now() >= deadline) wasStopped = true;
+            if (control) control->nodes.fetch_add(DEADLINE_CHECK_NODES, std::memory_order_relaxed);
+        }
+        if (nodeLimit != 0 && nodes > nodeLimit) wasStopped = true;
+        if (wasStopped || stop.load(std::memory_order_relaxed) || (control && control->isCancelled())) {
+            wasStopped = true;
+            return 0;
+        }
+        if (board.winner() != Player::None) return -(MATE_SCORE - ply);  // last mover won
+        if (board.isFull()) return 0;
+        if (depth == 0) return evaluate(board, toMove);
+
+        uint64_t key = TranspositionTable::keyFor(board.hash(), toMove);
+        int windowAlpha = alpha;
+        int tableMove = -1;
+        SharedEntry entry;
+        if (table.probe(key, entry)) {
+            tableMove = entry.bestMove;
+            if (entry.depth >= depth && ply > 0) {
+                int stored = fromTable(entry.score, ply);
+                if (entry.bound == Bound::Exact) return stored;
+                if (entry.bound == Bound::Lower && stored >= beta) return stored;
+                if (entry.bound == Bound::Upper && stored <= alpha) return stored;
+            }
+        }
+
+        Player opponent = otherPlayer(toMove);
+        int best = -INFINITE_SCORE;
+        int bestCell = -1;
+        // principal variation search: the first move gets the full window,
+        // the rest a null window that only asks whether they beat alpha, and
+        // are searched again properly when they do
+        bool firstMove = true;
+        auto searchChild = [&](int cell) {
+            board.makeMove(cell, toMove);
+            int score;
+            if (firstMove) {
+                score = -search(board, opponent, depth - 1, ply + 1, -beta, -alpha);
+                firstMove = false;
+            } else {
+                score = -search(board, opponent, depth - 1, ply + 1, -alpha - 1, -alpha);
+                if (score > alpha && score < beta && !wasStopped)
+                    score = -search(board, opponent, depth - 1, ply + 1, -beta, -alpha);
+            }
+            board.undoMove();
+            if (wasStopped) return true;
+            if (score > best) {
+                best = score;
+                bestCell = cell;
+                if (score > alpha) alpha = score;
+            }
+            return alpha >= beta;  // cut-off
+        };
+
+        int side = (toMove == Player::X) ? 0 : 1;
+        int moveList[BoardT::CELLS];
+        int keys[BoardT::CELLS];
+        int count = 0;
+        for (int cell : board.emptyCells()) {
+            moveList[count] = cell;
+            keys[count] = orderKey(cell, side, ply, tableMove, rootOffset);
+            ++count;
+        }
+        for (int i = 0; i < count; ++i) {
+            // bring the best remaining move forward; cut-offs usually come
+            // early, so most of the list is never sorted
+            int pick = i;
+            for (int j = i + 1; j < count; ++j)
+                if (keys[j] > keys[pick]) pick = j;
+            std::swap(moveList[i], moveList[pick]);
+            std::swap(keys[i], keys[pick]);
+
+            int cell = moveList[i];
+            if (searchChild(cell)) {
+                if (wasStopped) break;
+                ++cutoffs;
+                if (i == 0) ++firstMoveCutoffs;
+                if (killers[ply][0] != cell) {
+                    killers[ply][1] = killers[ply][0];
+                    killers[ply][0] = cell;
+                }
+                history[side][cell] += depth * depth;
+                if (history[side][cell] > HISTORY_LIMIT) ageHistory();
+                break;
+            }
+        }
+        if (wasStopped) return 0;
+
+        Bound bound = best <= windowAlpha ? Bound::Upper : best >= beta ? Bound::Lower : Bound::Exact;
+        table.store(key, toTable(best, ply), bound, bestCell, std::min(depth, 255));
+        if (ply == 0) bestRootMove = bestCell;
+        return best;
+    }
+
+    // higher is searched first: table move, killers, then history and the
+    // number of lines through the cell. Helper roots (rootOffset != 0)
+    // take the cells in rotated order instead, to spread the threads out.
+    int orderKey(int cell, int side, int ply, int tableMove, int rootOffset) const {
+        if (cell == tableMove) return std::numeric_limits<int>::max();
+        if (ply == 0 && rootOffset != 0)
+            return -((cell - rootOffset + BoardT::CELLS) % BoardT::CELLS);
+        if (!moveOrdering) return -cell;
+        if (cell == killers[ply][0]) return 1 << 30;
+        if (cell == killers[ply][1]) return 1 << 29;
+        return history[side][cell] * 64 + prior[cell];
+    }
+
+    void ageHistory() {
+        for (auto& row : history)
+            for (int& score : row) score /= 2;
+    }
+
+    // mate scores are stored relative to the node, not the root
+    static int toTable(int score, int ply) {
+        return score > MATE_BOUND ? score + ply : score < -MATE_BOUND ? score - ply : score;
+    }
+    static int fromTable(int score, int ply) {
+        return score > MATE_BOUND ? score - ply : score < -MATE_BOUND ? score + ply : score;
+    }
+
+    static constexpr int HISTORY_LIMIT = 1 << 22;  // keeps history * 64 below the killers
+    static constexpr uint64_t DEADLINE_CHECK_NODES = 1024;  // power of two
+
+    SharedTranspositionTable& table;
+    const std::atomic<bool>& stop;
+    SearchControl* control = nullptr;
+    bool moveOrdering;
+    bool wasStopped = false;
+    bool hasDeadline = false;
+    std::chrono::steady_clock::time_point deadline;
+    uint64_t nodeLimit = 0;
+    int bestRootMove = -1;
+    int prior[BoardT::CELLS];           // lines through each cell: center, then corners on 3x3
+    int killers[BoardT::CELLS + 1][2];  // last two moves that cut off at each ply
+    int history[2][BoardT::CELLS];      // depth^2 per cut-off, per side and cell
+};
+
+struct LazySmpResult {
+    int cell = -1;   // best move, -1 if the game is over
+    int score = 0;   // negamax scale, from toMove
+    int depth = 0;   // plies the main thread searched
+    bool timedOut = false;    // the time limit stopped the search before maxDepth
+    bool outOfNodes = false;  // the node budget did
+    bool cancelled = false;   // options.control was cancelled; cell is -1 if depth 1 never finished
+    std::vector<ThreadStats> threads;  // [0] is the main thread
+};
+
+// Lazy SMP: `threads` workers search the same root by iterative deepening
+// over one shared table. Helpers start one ply deeper on every other
+// thread and try the root moves in a rotated order, so they fill the table
+// ahead of the main thread; the main thread's last full iteration is the
+// result. Each iteration starts with an aspiration window around the last
+// score. maxDepth is capped at the number of empty cells.
+// With a time limit the move comes from the last depth completed in time;
+// depth 1 of the main thread is always completed, so there is always a move.
+// A node budget works the same way but counts the main thread's nodes, so
+// with one thread the result depends only on the position and the budget.
+// Cancelling options.control stops every thread within about a node.
+template <typename BoardT>
+LazySmpResult lazySmpSearch(const BoardT& board, Player toMove, const NegamaxOptions& options,
+                            SharedTranspositionTable& table) {
+    LazySmpResult result;
+    unsigned threads = std::max(1u, options.threads);
+    int maxDepth = options.maxDepth;
+    result.threads.resize(threads);
+    int emptyCount = BoardT::CELLS - board.moveCount();
+    if (maxDepth <= 0 || maxDepth > emptyCount) maxDepth = emptyCount;
+    if (board.isGameOver()) return result;
+
+    std::atomic<bool> stop(false);
+    auto searchStart = std::chrono::steady_clock::now();
+    auto deadline = searchStart + options.timeLimit;
+    bool limited = options.timeLimit.count() > 0;
+    auto run = [&](unsigned id) {
+        auto start = std::chrono::steady_clock::now();
+        SearchWorker<BoardT> worker(table, stop, options.moveOrdering);
+        worker.setControl(options.control);
+        if (limited && id != 0) worker.setDeadline(deadline);
+        BoardT work = board;
+        int offset = static_cast<int>(id * 7919 % BoardT::CELLS);
+        int previous = 0;
+        for (int depth = 1 + static_cast<int>(id % 2); depth <= maxDepth; ++depth) {
+            // aspiration: expect about the previous iteration's score and
+            // widen the window on whichever side the search fails
+            int window = ASPIRATION_WINDOW;
+            bool aspire = depth > 1 && previous > -MATE_BOUND && previous < MATE_BOUND;
+            int alpha = aspire ? previous - window : -INFINITE_SCORE;
+            int beta = aspire ? previous + window : INFINITE_SCORE;
+            int score;
+            int cell;
+            for (;;) {
+                cell = worker.searchRoot(work, toMove, depth, score, offset, alpha, beta);
+                if (worker.aborted()) break;
+                window = (window > INFINITE_SCORE / 4) ? INFINITE_SCORE : window * 4;
+                if (score <= alpha) {
+                    alpha = (score < -MATE_BOUND) ? -INFINITE_SCORE : std::max(-INFINITE_SCORE, score - window);
+                } else if (score >= beta) {
+                    beta = (score > MATE_BOUND) ? INFINITE_SCORE : std::min(INFINITE_SCORE, score + window);
+                } else {
+                    break;
+                }
+            }
+            if (worker.aborted()) {
+                if (id == 0) {
+                    result.cancelled = options.control && options.control->isCancelled();
+                    result.outOfNodes = !result.cancelled && worker.outOfNodes();
+                    result.timedOut = !result.cancelled && !result.outOfNodes;
+                }
+                break;
+            }
+            previous = score;
+            result.threads[id].depth = depth;
+            if (id == 0) {
+                result.cell = cell;
+                result.score = score;
+                result.depth = depth;
+                if (options.control) options.control->depth.store(depth, std::memory_order_relaxed);
+            }
+            if (score > MATE_BOUND || score < -MATE_BOUND) break;  // forced, deeper won't change it
+            if (id == 0) {  // limits apply from depth 2 on
+                if (limited) worker.setDeadline(deadline);
+                if (options.nodeBudget) worker.setNodeLimit(std::max(options.nodeBudget, worker.nodes));
+            }
+        }
+        if (id == 0) stop.store(true, std::memory_order_relaxed);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        result.threads[id].nodes = worker.nodes;
+        result.threads[id].cutoffs = worker.cutoffs;
+        result.threads[id].firstMoveCutoffs = worker.firstMoveCutoffs;
+        result.threads[id].seconds = elapsed.count();
+    };
+
+    std::vector<std::thread> helpers;
+    for (unsigned id = 1; id < threads; ++id) helpers.emplace_back(run, id);
+    run(0);
+    for (std::thread& helper : helpers) helper.join();
+    return result;
+}
+
+#endif // NEGAMAX_H
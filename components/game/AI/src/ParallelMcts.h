@@ -0,0 +1,232 @@
+#ifndef PARALLEL_MCTS_H
+#define PARALLEL_MCTS_H
+
+#include "Mcts.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// Tree-parallel MCTS: every thread descends the same tree. Visit and score
+// counters are atomics, and a visit is counted on the way down (a virtual
+// loss until the playout result is added), which steers concurrent threads
+// apart. A thread expands a node by atomically claiming one untried move
+// and publishing the new child with a compare-and-swap on the parent's
+// child list, so no locks are taken. With more than one thread the result
+// depends on scheduling; use Mcts for reproducible runs.
+template <typename BoardT>
+class ParallelMcts : public MctsEngine {
+public:
+    ParallelMcts(const MctsOptions& options, unsigned threads) { setOptions(options, threads); }
+
+    // new options for the following searches; the pool only ever grows.
+    // The worker threads live for one search each.
+    void setOptions(const MctsOptions& newOptions, unsigned threadCount) {
+        options = newOptions;
+        threads = std::max(1u, threadCount);
+        size_t needed = static_cast<size_t>(std::max(options.iterations, 0)) + 1;
+        if (capacity < needed) {
+            pool.reset(new Node[needed]);
+            capacity = needed;
+        }
+    }
+
+    MctsResult search(const BoardT& board, Player toMove) {
+        MctsResult result;
+        used.store(0, std::memory_order_relaxed);
+        started.store(0, std::memory_order_relaxed);
+        completed.store(0, std::memory_order_relaxed);
+        if (board.isGameOver()) return result;
+
+        int root = newNode(-1, otherPlayer(toMove), board.emptyCells());  // mover: who moved last
+        start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (unsigned id = 1; id < threads; ++id)
+            workers.emplace_back([this, &board, root, id] { work(board, root, id); });
+        work(board, root, 0);
+        for (std::thread& worker : workers) worker.join();
+
+        int best = -1;
+        for (int child = pool[root].firstChild.load(std::memory_order_acquire); child >= 0;
+             child = pool[child].nextSibling) {
+            if (best < 0 || pool[child].visits.load(std::memory_order_relaxed) >
+                            pool[best].visits.load(std::memory_order_relaxed))
+                best = child;
+        }
+        result.iterations = completed.load();
+        result.cancelled = options.control && options.control->isCancelled() &&
+                           result.iterations < options.iterations;
+        result.timedOut = !result.cancelled && options.timeLimit.count() > 0 &&
+                          result.iterations < options.iterations;
+        result.nodesUsed = std::min(used.load(), capacity);
+        if (best >= 0) {
+            result.cell = pool[best].move;
+            result.visits = pool[best].visits.load();
+            result.winRate = pool[best].score.load() / (2.0 * result.visits);
+        }
+        return result;
+    }
+
+    unsigned threadCount() const { return threads; }
+
+    // starting rng state of thread `id`: hashed rather than offset, since
+    // seed + k * golden ratio would be the seed's own stream k draws on
+    static uint64_t threadSeed(uint64_t seed, unsigned id) {
+        uint64_t state = seed ^ (static_cast<uint64_t>(id) << 32);
+        return splitMix64(state);
+    }
+
+private:
+    static constexpr int WORDS = CellMask<BoardT::CELLS>::WORDS;
+
+    struct Node {
+        std::atomic<int32_t> firstChild{-1};
+        int32_t nextSibling = -1;  // written once, before the node is published
+        int16_t move = -1;
+        Player mover = Player::None;
+        std::atomic<uint32_t> visits{0};  // includes playouts still running (virtual loss)
+        std::atomic<uint64_t> score{0};   // 2 per win, 1 per draw, for mover
+        std::atomic<uint64_t> untried[WORDS];
+    };
+
+    // returns -1 once the pool is used up
+    int newNode(int move, Player mover, const CellMask<BoardT::CELLS>& untried) {
+        size_t index = used.fetch_add(1, std::memory_order_relaxed);
+        if (index >= capacity) return -1;
+        Node& node = pool[index];
+        node.firstChild.store(-1, std::memory_order_relaxed);
+        node.nextSibling = -1;
+        node.move = static_cast<int16_t>(move);
+        node.mover = mover;
+        node.visits.store(1, std::memory_order_relaxed);  // the creating playout
+        node.score.store(0, std::memory_order_relaxed);
+        for (int w = 0; w < WORDS; ++w) node.untried[w].store(untried.word(w), std::memory_order_relaxed);
+        return static_cast<int>(index);
+    }
+
+    void publish(int parent, int child) {
+        int head = pool[parent].firstChild.load(std::memory_order_relaxed);
+        do {
+            pool[child].nextSibling = head;
+        } while (!pool[parent].firstChild.compare_exchange_weak(head, child, std::memory_order_release,
+                                                                std::memory_order_relaxed));
+    }
+
+    // take a random untried move of `node` for this thread, -1 if none left
+    int claimUntried(int node, uint64_t& rng) {
+        for (;;) {
+            int total = 0;
+            uint64_t words[WORDS];
+            for (int w = 0; w < WORDS; ++w) {
+                words[w] = pool[node].untried[w].load(std::memory_order_relaxed);
+                total += popCount(words[w]);
+            }
+            if (total == 0) return -1;
+            int skip = static_cast<int>(splitMix64(rng) % static_cast<uint64_t>(total));
+            int w = 0;
+            while (popCount(words[w]) <= skip) skip -= popCount(words[w++]);
+            uint64_t bits = words[w];
+            for (; skip > 0; --skip) bits &= bits - 1;
+            uint64_t bit = bits & (~bits + 1);
+            if (pool[node].untried[w].fetch_and(~bit, std::memory_order_relaxed) & bit)
+                return w * 64 + countTrailingZeros(bit);
+            // another thread took it first: try again
+        }
+    }
+
+    // UCT child, counting the visit now so other threads see the virtual loss
+    int selectChild(int parent) {
+        double logVisits = std::log(static_cast<double>(pool[parent].visits.load(std::memory_order_relaxed)));
+        int best = -1;
+        double bestValue = -1;
+        for (int child = pool[parent].firstChild.load(std::memory_order_acquire); child >= 0;
+             child = pool[child].nextSibling) {
+            double visits = pool[child].visits.load(std::memory_order_relaxed);
+            double score = static_cast<double>(pool[child].score.load(std::memory_order_relaxed));
+            double value = score / (2.0 * visits) + options.exploration * std::sqrt(logVisits / visits);
+            if (value > bestValue) {
+                bestValue = value;
+                best = child;
+            }
+        }
+        if (best >= 0) pool[best].visits.fetch_add(1, std::memory_order_relaxed);
+        return best;
+    }
+
+    void work(const BoardT& board, int root, unsigned id) {
+        uint64_t rng = threadSeed(options.seed, id);
+        bool limited = options.timeLimit.count() > 0;
+        BoardT work = board;
+        int path[BoardT::CELLS + 1];
+
+        for (;;) {
+            int64_t iteration = started.fetch_add(1, std::memory_order_relaxed);
+            if (iteration >= options.iterations) break;
+            if (limited && (iteration & 63) == 0 && std::chrono::steady_clock::now() - start >= options.timeLimit) {
+                started.store(options.iterations, std::memory_order_relaxed);
+                break;
+            }
+            if (options.control) {
+                if (options.control->isCancelled()) {
+                    started.store(options.iterations, std::memory_order_relaxed);
+                    break;
+                }
+                if ((iteration & 63) == 0 && iteration > 0)
+                    options.control->nodes.fetch_add(64, std::memory_order_relaxed);
+            }
+
+            int node = root;
+            int length = 0;
+            pool[root].visits.fetch_add(1, std::memory_order_relaxed);
+            path[length++] = node;
+            while (!work.isGameOver()) {
+                // expansion: claim an untried move and publish its node
+                int cell = claimUntried(node, rng);
+                if (cell >= 0) {
+                    Player mover = otherPlayer(pool[node].mover);
+                    work.makeMove(cell, mover);
+                    auto untried = work.isGameOver() ? CellMask<BoardT::CELLS>() : work.emptyCells();
+                    int child = newNode(cell, mover, untried);
+                    if (child >= 0) {
+                        publish(node, child);
+                        path[length++] = child;
+                    } else {
+                        work.undoMove();  // pool used up: give the move back, play out from here
+                        pool[node].untried[cell / 64].fetch_or(uint64_t(1) << (cell % 64), std::memory_order_relaxed);
+                    }
+                    break;
+                }
+                // selection: fully expanded, follow UCT
+                int child = selectChild(node);
+                if (child < 0) break;  // children still being published
+                node = child;
+                work.makeMove(pool[node].move, pool[node].mover);
+                path[length++] = node;
+            }
+
+            // simulation: random games to the end
+            int games = std::max(options.leafPlayouts, 1);
+            PlayoutTally tally = mcts_detail::simulate(work, otherPlayer(pool[path[length - 1]].mover), games, rng);
+
+            // backpropagation: one visit per node was counted on the way down
+            for (int i = 0; i < length; ++i) {
+                Node& n = pool[path[i]];
+                if (games > 1) n.visits.fetch_add(static_cast<uint32_t>(games - 1), std::memory_order_relaxed);
+                uint64_t points = mcts_detail::points(tally, n.mover);
+                if (points) n.score.fetch_add(points, std::memory_order_relaxed);
+            }
+            while (work.moveCount() > board.moveCount()) work.undoMove();
+            completed.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    MctsOptions options;
+    unsigned threads = 1;
+    size_t capacity = 0;
+    std::unique_ptr<Node[]> pool;
+    std::atomic<size_t> used{0};
+    std::atomic<int64_t> started{0};  // iterations handed out
+    std::atomic<int> completed{0};    // iterations finished
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif // PARALLEL_MCTS_H
@@ -0,0 +1,75 @@
+#ifndef PARALLEL_SEARCH_H
+#define PARALLEL_SEARCH_H
+
+#include "AI.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+// findBestMove with the root moves split across a thread pool. Each root
+// move is searched on its own board copy and table; the best score found so
+// far is shared so later moves can be cut off against it. Returns exactly
+// the move findBestMove would (first best move in cell order).
+// tableEntries sizes each root move's table, 0 = sized to the board.
+template <typename BoardT>
+std::pair<int, int> findBestMoveParallel(const BoardT& board, Player aiPlayer, ThreadPool& pool,
+                                         size_t tableEntries = 0) {
+    constexpr int N = BoardT::SIZE;
+    constexpr int NO_SCORE = std::numeric_limits<int>::min();
+    // one table per root move, allocated and cleared per call; a 3x3
+    // subtree has a few thousand positions at most
+    if (tableEntries == 0) tableEntries = std::is_same_v<BoardT, Board> ? size_t(1) << 13 : size_t(1) << 16;
+
+    // If board is empty, take center
+    if (board.moveCount() == 0) {
+        return {N / 2, N / 2};
+    }
+
+    // Check for immediate winning move first
+    BoardT work = board;
+    for (int cell : board.emptyCells()) {
+        work.makeMove(cell, aiPlayer);
+        bool wins = work.winner() == aiPlayer;
+        work.undoMove();
+        if (wins) {
+            return {cell / N, cell % N};
+        }
+    }
+
+    // Moves scoring below the shared bound come back as at most bound - 1
+    // and can never win; moves reaching it are searched exactly, so ties
+    // still resolve by cell order whatever order the threads finish in.
+    std::atomic<int> sharedBest(NO_SCORE);
+    std::vector<int> cells;
+    std::vector<std::future<int>> scores;
+    for (int cell : board.emptyCells()) {
+        cells.push_back(cell);
+        scores.push_back(pool.submit([&board, &sharedBest, cell, aiPlayer, tableEntries] {
+            BoardT child = board;
+            TranspositionTable table(tableEntries);
+            child.makeMove(cell, aiPlayer);
+            int best = sharedBest.load(std::memory_order_relaxed);
+            int alpha = (best == NO_SCORE) ? NO_SCORE : best - 1;
+            int score = minimax(child, otherPlayer(aiPlayer), aiPlayer, alpha,
+                                std::numeric_limits<int>::max(), 0, &table);
+            while (score > best && !sharedBest.compare_exchange_weak(best, score, std::memory_order_relaxed)) {
+            }
+            return score;
+        }));
+    }
+
+    int bestScore = NO_SCORE;
+    std::pair<int, int> bestMove = {-1, -1};
+    for (size_t i = 0; i < cells.size(); ++i) {
+        int score = scores[i].get();
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = {cells[i] / N, cells[i] % N};
+        }
+    }
+    return bestMove;
+}
+
+#endif // PARALLEL_SEARCH_H
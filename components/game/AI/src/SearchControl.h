@@ -0,0 +1,19 @@
+#ifndef SEARCH_CONTROL_H
+#define SEARCH_CONTROL_H
+
+#include <atomic>
+#include <cstdint>
+
+// Lets another thread stop a running search and watch how far it got.
+// cancel() makes the search return at its next check; nodes and depth
+// grow while it runs. Use a fresh one for every search.
+struct SearchControl {
+    std::atomic<bool> cancelled{false};
+    std::atomic<uint64_t> nodes{0};  // nodes searched by all threads (Mcts: iterations), roughly
+    std::atomic<int> depth{0};       // deepest completed iteration (negamax engines)
+
+    void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+};
+
+#endif // SEARCH_CONTROL_H
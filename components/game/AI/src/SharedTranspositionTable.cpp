@@ -0,0 +1,15 @@
+#include "SharedTranspositionTable.h"
+
+SharedTranspositionTable::SharedTranspositionTable(size_t entries) {
+    size_t size = 1;
+    while (size < entries) size <<= 1;
+    slots.reset(new Slot[size]);
+    mask = size - 1;
+}
+
+void SharedTranspositionTable::clear() {
+    for (size_t i = 0; i <= mask; ++i) {
+        slots[i].keyXorData.store(0, std::memory_order_relaxed);
+        slots[i].data.store(0, std::memory_order_relaxed);
+    }
+}
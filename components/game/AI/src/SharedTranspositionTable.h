@@ -0,0 +1,70 @@
+#ifndef SHARED_TRANSPOSITION_TABLE_H
+#define SHARED_TRANSPOSITION_TABLE_H
+
+#include "TranspositionTable.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// what a probe of the shared table hands back
+struct SharedEntry {
+    int score = 0;      // from the side to move
+    int bestMove = -1;  // cell, -1 if none
+    int depth = 0;      // remaining depth the score was searched to
+    Bound bound = Bound::Exact;
+};
+
+// Transposition table that many search threads read and write at once
+// without locks. Each slot holds the packed entry and key ^ entry as two
+// relaxed atomics; a slot torn by a concurrent write no longer XORs back
+// to the probed key and reads as a miss.
+class SharedTranspositionTable {
+public:
+    // entries is rounded up to a power of two
+    explicit SharedTranspositionTable(size_t entries = size_t(1) << 20);
+
+    bool probe(uint64_t key, SharedEntry& out) const {
+        const Slot& slot = slots[key & mask];
+        uint64_t data = slot.data.load(std::memory_order_relaxed);
+        uint64_t check = slot.keyXorData.load(std::memory_order_relaxed);
+        if (!(data & VALID) || (check ^ data) != key) return false;
+        out.score = static_cast<int32_t>(static_cast<uint32_t>(data));
+        out.bestMove = static_cast<int>((data >> 32) & 0xFFFF) - 1;
+        out.depth = static_cast<int>((data >> 48) & 0xFF);
+        out.bound = static_cast<Bound>((data >> 56) & 0x3);
+        return true;
+    }
+
+    // keeps a deeper result for the same position over a shallower one
+    void store(uint64_t key, int score, Bound bound, int bestMove, int depth) {
+        Slot& slot = slots[key & mask];
+        uint64_t old = slot.data.load(std::memory_order_relaxed);
+        if ((old & VALID) && (slot.keyXorData.load(std::memory_order_relaxed) ^ old) == key &&
+            static_cast<int>((old >> 48) & 0xFF) > depth)
+            return;
+        uint64_t data = static_cast<uint32_t>(score) |
+                        (static_cast<uint64_t>(bestMove + 1) & 0xFFFF) << 32 |
+                        static_cast<uint64_t>(depth & 0xFF) << 48 |
+                        static_cast<uint64_t>(bound) << 56 |
+                        VALID;
+        slot.keyXorData.store(key ^ data, std::memory_order_relaxed);
+        slot.data.store(data, std::memory_order_relaxed);
+    }
+
+    void clear();
+    size_t size() const { return mask + 1; }
+
+private:
+    static constexpr uint64_t VALID = uint64_t(1) << 63;
+
+    struct Slot {
+        std::atomic<uint64_t> keyXorData{0};
+        std::atomic<uint64_t> data{0};
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+};
+
+#endif // SHARED_TRANSPOSITION_TABLE_H
@@ -0,0 +1,39 @@
+#include "Tablebase.h"
+#include "PositionIndex.h"
+#include "AI.h"
+#include "tablebase_data.h"  // generated by gen_tablebase
+
+PerfectMove perfectMove(const Board& board, Player toMove) {
+    return decodeTablebaseEntry(TABLEBASE_DATA[packedToIndex(board.packed())][toMove == Player::O ? 1 : 0]);
+}
+
+// Find the best move for the AI
+std::pair<int, int> findBestMove(const Board& board, Player aiPlayer) {
+    PerfectMove best = perfectMove(board, aiPlayer);
+    if (best.cell < 0) return {-1, -1};  // game already over
+    return {best.cell / 3, best.cell % 3};
+}
+
+std::vector<MoveAnalysis> analyzePosition(const Board& board, Player player) {
+    std::vector<MoveAnalysis> moves;
+    if (board.isGameOver()) return moves;
+
+    int emptyCount = Board::CELLS - board.moveCount();
+    Board work = board;
+    for (int cell : board.emptyCells()) {
+        work.makeMove(cell, player);
+        int score;
+        if (work.winner() == player) {
+            score = Board::CELLS + 1;  // wins at once
+        } else if (work.isFull()) {
+            score = 0;
+        } else {
+            // opponent's value, one ply further away and negated
+            int reply = perfectMove(work, otherPlayer(player)).score;
+            score = reply > 0 ? -(reply - 1) : reply < 0 ? -(reply + 1) : 0;
+        }
+        work.undoMove();
+        moves.push_back(describeMove<Board::CELLS>(cell, Board::SIZE, score, emptyCount));
+    }
+    return moves;
+}
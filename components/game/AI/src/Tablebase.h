@@ -0,0 +1,27 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include "Board.h"
+#include <cstdint>
+
+// Perfect play for every 3x3 position and either side to move, generated
+// at build time by tools/gen_tablebase.
+// score uses findBestMove's scale: 11 - plies for a win (10 when the move
+// wins at once), the negation for a loss, 0 for a draw.
+struct PerfectMove {
+    int cell;   // best move (row * 3 + col), -1 once the game is over
+    int score;  // game-theoretic value of the position for toMove
+};
+
+// Among equally good moves the center comes first, then corners, then edges.
+PerfectMove perfectMove(const Board& board, Player toMove);
+
+// one byte per entry: (score + 10) * 10 + (cell + 1)
+constexpr uint8_t encodeTablebaseEntry(PerfectMove move) {
+    return static_cast<uint8_t>((move.score + 10) * 10 + (move.cell + 1));
+}
+constexpr PerfectMove decodeTablebaseEntry(uint8_t entry) {
+    return { entry % 10 - 1, entry / 10 - 10 };
+}
+
+#endif // TABLEBASE_H
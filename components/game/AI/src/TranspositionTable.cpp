@@ -0,0 +1,12 @@
+#include "TranspositionTable.h"
+
+TranspositionTable::TranspositionTable(size_t entries) {
+    size_t size = 1;
+    while (size < entries) size <<= 1;
+    this->entries.resize(size);
+    mask = size - 1;
+}
+
+void TranspositionTable::clear() {
+    for (TTEntry& entry : entries) entry = TTEntry();
+}
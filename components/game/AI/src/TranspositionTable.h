@@ -0,0 +1,57 @@
+#ifndef TRANSPOSITION_TABLE_H
+#define TRANSPOSITION_TABLE_H
+
+#include "globals.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// how a stored score relates to the true value of the position
+enum class Bound : uint8_t { Exact, Lower, Upper };
+
+struct TTEntry {
+    uint64_t key = 0;       // full search key, to reject index collisions
+    int16_t score = 0;      // from the side to move, wins/losses relative to this node
+    int16_t bestMove = -1;  // cell of the best child found, -1 if none
+    Bound bound = Bound::Exact;
+    bool used = false;
+};
+
+// Fixed-size, always-replace cache of search results keyed on
+// Board::hash() plus the side to move. Keep one per game (or per engine)
+// and pass it to every findBestMove call so later moves start warm.
+class TranspositionTable {
+public:
+    // entries is rounded up to a power of two
+    explicit TranspositionTable(size_t entries = size_t(1) << 16);
+
+    // search key: position hash with the side to move mixed in
+    static uint64_t keyFor(uint64_t positionHash, Player toMove) {
+        return toMove == Player::O ? positionHash ^ 0xA5B35705F2C1E9D7ull : positionHash;
+    }
+
+    bool probe(uint64_t key, TTEntry& out) const {
+        const TTEntry& entry = entries[key & mask];
+        if (!entry.used || entry.key != key) return false;
+        out = entry;
+        return true;
+    }
+
+    void store(uint64_t key, int score, Bound bound, int bestMove) {
+        TTEntry& entry = entries[key & mask];
+        entry.key = key;
+        entry.score = static_cast<int16_t>(score);
+        entry.bestMove = static_cast<int16_t>(bestMove);
+        entry.bound = bound;
+        entry.used = true;
+    }
+
+    void clear();
+    size_t size() const { return entries.size(); }
+
+private:
+    std::vector<TTEntry> entries;
+    size_t mask;
+};
+
+#endif // TRANSPOSITION_TABLE_H
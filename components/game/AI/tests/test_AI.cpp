@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <vector>
 #include "AI.h"
 #include "Board.h"
+#include "PositionIndex.h"
 
 // Test AI winning immediately (X, row)
 TEST(AITest, ImmediateWinXRow) {
@@ -105,3 +107,171 @@ TEST(AITest, PreventForkO) {
         });
     EXPECT_TRUE(is_edge_move);  // O must play an edge to prevent X's fork
 }
+
+// Test minimax searches in place and leaves the board as it found it
+TEST(AITest, MinimaxLeavesBoardUnchanged) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    minimax(board, Player::X, Player::X, -100, 100, 0);
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            EXPECT_EQ(board.isCellEmpty(i, j), !((i == 0 && j == 0) || (i == 1 && j == 1)));
+    EXPECT_TRUE(board.undoMove());
+    EXPECT_TRUE(board.isCellEmpty(1, 1));
+}
+
+// Test the generic search on a 4x4 board, three in a row
+TEST(AITest, GenericBoardImmediateWin) {
+    BasicBoard<4, 3> board;
+    board.makeMove(3, 1, Player::O);
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(3, 2, Player::O);
+    board.makeMove(1, 1, Player::X);
+    auto move = findBestMove(board, Player::O);
+    // O completes the bottom row on either side
+    EXPECT_TRUE(move == std::make_pair(3, 0) || move == std::make_pair(3, 3));
+}
+
+TEST(AITest, GenericBoardBlocksFour) {
+    BasicBoard<4, 4> board;
+    const char* rows[4] = {"XOXO", "XXX-", "OOXO", "--O-"};
+    for (int r = 0; r < 4; ++r)
+        for (int c = 0; c < 4; ++c)
+            if (rows[r][c] != '-')
+                board.makeMove(r, c, rows[r][c] == 'X' ? Player::X : Player::O);
+    // Board:
+    // X O X O
+    // X X X _
+    // O O X O
+    // _ _ O _
+    auto move = findBestMove(board, Player::O);
+    EXPECT_EQ(move, std::make_pair(1, 3));  // O blocks X's row
+}
+
+TEST(AITest, GenericBoardEmptyTakesCenter) {
+    BasicBoard<5, 4> board;
+    EXPECT_EQ(findBestMove(board, Player::X), std::make_pair(2, 2));
+}
+
+// Test the transposition table gives the same scores as a plain search
+TEST(AITest, TableSearchMatchesPlainSearch) {
+    TranspositionTable table(1 << 12);
+    for (int index = 0; index < POSITION_COUNT; index += 7) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        for (Player ai : {Player::X, Player::O}) {
+            for (Player toMove : {Player::X, Player::O}) {
+                int plain = minimax(board, toMove, ai, -100, 100, 0);
+                int cached = minimax(board, toMove, ai, -100, 100, 0, &table);
+                ASSERT_EQ(plain, cached) << "index " << index;
+            }
+        }
+    }
+}
+
+// Test table bounds stay sound when stored under a narrow window at one
+// root depth and read back at another: each result must agree with the
+// plain search (equal inside the window, on the same side outside it)
+TEST(AITest, TableBoundsHoldAcrossWindowsAndDepths) {
+    const int windows[][2] = { {-100, 100}, {-10, -1}, {1, 10}, {-1, 1}, {-3, 0}, {0, 3}, {-8, -4} };
+    auto consistent = [](int result, int exact, int alpha, int beta) {
+        if (exact <= alpha) return result <= alpha;
+        if (exact >= beta) return result >= beta;
+        return result == exact;
+    };
+    TranspositionTable table(1 << 10);
+    for (int index = 0; index < POSITION_COUNT; index += 5) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        if (board.isGameOver()) continue;
+        Player toMove = (board.moveCount() % 2 == 0) ? Player::X : Player::O;
+        int exact[4];
+        for (int depth = 0; depth < 4; ++depth) exact[depth] = minimax(board, toMove, toMove, -100, 100, depth);
+
+        for (const auto& stored : windows) {
+            for (int storeDepth = 0; storeDepth < 4; ++storeDepth) {
+                for (int depth = 0; depth < 4; ++depth) {
+                    for (const auto& window : { stored, windows[0] }) {
+                        table.clear();
+                        minimax(board, toMove, toMove, stored[0], stored[1], storeDepth, &table);
+                        int cached = minimax(board, toMove, toMove, window[0], window[1], depth, &table);
+                        ASSERT_TRUE(consistent(cached, exact[depth], window[0], window[1]))
+                            << "index " << index << " stored [" << stored[0] << ", " << stored[1]
+                            << "] at depth " << storeDepth << ", read [" << window[0] << ", " << window[1]
+                            << "] at depth " << depth << ": got " << cached << ", exact " << exact[depth];
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Test a warm table keeps choosing the same moves across a whole game
+TEST(AITest, TablePersistsAcrossMoves) {
+    TranspositionTable table;
+    Board plain, cached;
+    Player p = Player::X;
+    while (!plain.isGameOver()) {
+        auto expected = findBestMove<Board>(plain, p);
+        EXPECT_EQ(findBestMove<Board>(cached, p, &table), expected);
+        EXPECT_EQ(findBestMove<Board>(cached, p, &table), expected);  // warm
+        plain.makeMove(expected.first, expected.second, p);
+        cached.makeMove(expected.first, expected.second, p);
+        p = otherPlayer(p);
+    }
+    EXPECT_EQ(plain.winner(), Player::None);  // perfect play draws
+}
+
+// Test analyzePosition scores every legal move and agrees with findBestMove
+TEST(AITest, AnalyzePositionScoresEveryMove) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(1, 1, Player::O);
+    // X X _
+    // O O _
+    // _ _ _
+    auto moves = analyzePosition<Board>(board, Player::X);
+    ASSERT_EQ(moves.size(), 5u);
+    for (const MoveAnalysis& move : moves) {
+        if (move.row == 0 && move.col == 2) {
+            EXPECT_EQ(move.outcome, Outcome::Win);
+            EXPECT_EQ(move.plies, 1);
+        } else if (move.row == 1 && move.col == 2) {
+            EXPECT_EQ(move.outcome, Outcome::Draw);  // blocks, O blocks back
+            EXPECT_EQ(move.plies, 5);               // until the board is full
+        } else {
+            EXPECT_EQ(move.outcome, Outcome::Loss);  // O completes row 1
+            EXPECT_EQ(move.plies, 2);
+        }
+    }
+    auto best = std::max_element(moves.begin(), moves.end(),
+        [](const MoveAnalysis& a, const MoveAnalysis& b) { return a.score < b.score; });
+    EXPECT_EQ(std::make_pair(best->row, best->col), findBestMove<Board>(board, Player::X));
+}
+
+// Test analyzePosition on a generic board, and nothing once the game is over
+TEST(AITest, AnalyzePositionGenericBoard) {
+    BasicBoard<4, 3> board;
+    // X X _ O
+    // X O _ X
+    // O X O O
+    // O X O X
+    const int cells[] = {0, 3, 1, 5, 4, 8, 7, 10, 9, 11, 13, 12, 15, 14};
+    Player p = Player::X;
+    for (int cell : cells) {
+        ASSERT_TRUE(board.makeMove(cell, p));
+        p = otherPlayer(p);
+    }
+    ASSERT_FALSE(board.isGameOver());
+    auto moves = analyzePosition(board, Player::X);
+    ASSERT_EQ(moves.size(), 2u);
+    EXPECT_EQ(moves[0].outcome, Outcome::Win);   // (0,2) completes the top row
+    EXPECT_EQ(moves[0].plies, 1);
+    EXPECT_EQ(moves[1].outcome, Outcome::Loss);  // (1,2) lets O take (0,2)
+    EXPECT_EQ(moves[1].plies, 2);
+    board.makeMove(0, 2, Player::X);
+    EXPECT_TRUE(analyzePosition(board, Player::O).empty());
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "BatchSearch.h"
+#include "PositionIndex.h"
+
+namespace {
+
+// every reachable 3x3 position with the side to move
+void reachablePositions(std::vector<Board>& boards, std::vector<Player>& players) {
+    for (int index = 0; index < POSITION_COUNT; ++index) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        boards.push_back(board);
+        players.push_back(board.moveCount() % 2 == 0 ? Player::X : Player::O);
+    }
+}
+
+int sign(int score) {
+    return (score > 0) - (score < 0);
+}
+
+} // namespace
+
+// Test a batch gives findBestMove's answer for every 3x3 position, with
+// finished games left at {-1, -1}
+TEST(BatchSearchTest, MatchesTablebaseOnEveryPosition) {
+    std::vector<Board> boards;
+    std::vector<Player> players;
+    reachablePositions(boards, players);
+    ASSERT_EQ(boards.size(), static_cast<size_t>(REACHABLE_POSITION_COUNT));
+
+    std::vector<std::pair<int, int>> single(boards.size());
+    findBestMoves(boards.data(), players.data(), single.data(), boards.size());
+
+    SearchOptions options;
+    options.threads = 4;
+    BatchSearcher<Board> searcher(options);
+    std::vector<std::pair<int, int>> pooled(boards.size(), {7, 7});
+    searcher.findBestMoves(boards.data(), players.data(), pooled.data(), boards.size());
+
+    for (size_t i = 0; i < boards.size(); ++i) {
+        std::pair<int, int> expected = findBestMove(boards[i], players[i]);
+        ASSERT_EQ(single[i], expected) << "position " << i;
+        ASSERT_EQ(pooled[i], expected) << "position " << i;
+    }
+    searcher.findBestMoves(boards.data(), players.data(), pooled.data(), 0);  // nothing to do
+}
+
+// Test batched full-depth searches on 4x4 keep the game-theoretic value:
+// after the chosen move the opponent is no better off than before
+TEST(BatchSearchTest, LargerBoardMovesAreOptimal) {
+    using Board4 = BasicBoard<4, 4>;
+    std::vector<Board4> boards;
+    std::vector<Player> players;
+    const int openings[][4] = { {5, 10, 6, 9}, {0, 5, 15, 10}, {5, 6, 9, 10}, {1, 2, 4, 8} };
+    for (const auto& opening : openings) {
+        Board4 board;
+        Player p = Player::X;
+        for (int cell : opening) {
+            board.makeMove(cell, p);
+            p = otherPlayer(p);
+        }
+        boards.push_back(board);
+        players.push_back(p);
+        board.makeMove(*board.emptyCells().begin(), p);  // and one ply later
+        boards.push_back(board);
+        players.push_back(otherPlayer(p));
+    }
+
+    SearchOptions options;
+    options.threads = 2;
+    options.tableEntries = size_t(1) << 18;
+    BatchSearcher<Board4> searcher(options);
+    std::vector<std::pair<int, int>> moves(boards.size());
+    searcher.findBestMoves(boards.data(), players.data(), moves.data(), boards.size());
+    std::vector<std::pair<int, int>> again(boards.size());
+    searcher.findBestMoves(boards.data(), players.data(), again.data(), boards.size());  // warm table
+
+    SearchOptions exact;
+    exact.engine = Engine::Negamax;
+    exact.tableEntries = size_t(1) << 18;
+    for (size_t i = 0; i < boards.size(); ++i) {
+        int before = searchBestMove(boards[i], players[i], exact).score;
+        for (const auto& move : {moves[i], again[i]}) {
+            ASSERT_TRUE(boards[i].isValidMove(move.first, move.second)) << "position " << i;
+            Board4 after = boards[i];
+            after.makeMove(move.first, move.second, players[i]);
+            int reply = after.isGameOver()
+                ? (after.winner() == Player::None ? 0 : -1)
+                : searchBestMove(after, otherPlayer(players[i]), exact).score;
+            EXPECT_EQ(sign(reply), -sign(before)) << "position " << i;
+        }
+    }
+}
+
+// Test one-position batches and a pooled batch both answer every position
+TEST(BatchSearchTest, OnePositionBatches) {
+    using Board4 = BasicBoard<4, 4>;
+    std::vector<Board4> boards(16);
+    std::vector<Player> players(16, Player::O);
+    for (size_t i = 0; i < boards.size(); ++i) boards[i].makeMove(static_cast<int>(i), Player::X);
+
+    SearchOptions options;
+    options.threads = 3;
+    options.maxDepth = 3;
+    BatchSearcher<Board4> pooled(options);
+    std::vector<std::pair<int, int>> moves(boards.size());
+    pooled.findBestMoves(boards.data(), players.data(), moves.data(), boards.size());
+
+    BatchSearcher<Board4> single(options);
+    for (size_t i = 0; i < boards.size(); ++i) {
+        std::pair<int, int> move;
+        single.clearCache();
+        single.findBestMoves(&boards[i], &players[i], &move, 1);
+        EXPECT_TRUE(boards[i].isValidMove(move.first, move.second)) << "position " << i;
+        EXPECT_TRUE(boards[i].isValidMove(moves[i].first, moves[i].second)) << "position " << i;
+    }
+}
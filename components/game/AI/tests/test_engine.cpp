@@ -0,0 +1,325 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include "Engine.h"
+#include "PositionIndex.h"
+#include "Tablebase.h"
+
+static SearchOptions lazySmp(unsigned threads, int maxDepth = 0) {
+    SearchOptions options;
+    options.engine = Engine::LazySmp;
+    options.threads = threads;
+    options.maxDepth = maxDepth;
+    options.tableEntries = size_t(1) << 16;
+    return options;
+}
+
+// Test a full-depth Lazy SMP search plays perfectly on every 3x3 position
+TEST(EngineTest, LazySmpPlaysPerfectly) {
+    for (int index = 0; index < POSITION_COUNT; index += 3) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        if (board.isGameOver()) continue;
+        Player p = (board.moveCount() % 2 == 0) ? Player::X : Player::O;
+        SearchResult result = searchBestMove(board, p, lazySmp(3));
+        ASSERT_NE(result.move.first, -1) << "index " << index;
+
+        // the chosen move keeps the tablebase value of the position
+        int best = perfectMove(board, p).score;
+        auto moves = analyzePosition(board, p);
+        auto chosen = std::find_if(moves.begin(), moves.end(), [&](const MoveAnalysis& m) {
+            return m.row == result.move.first && m.col == result.move.second;
+        });
+        ASSERT_NE(chosen, moves.end());
+        ASSERT_EQ(chosen->score, best) << "index " << index;
+        EXPECT_EQ(result.score > MATE_BOUND, best > 0);
+        EXPECT_EQ(result.score < -MATE_BOUND, best < 0);
+    }
+}
+
+// Test every thread reports its work and the main thread its depth
+TEST(EngineTest, LazySmpReportsPerThreadStats) {
+    BasicBoard<5, 4> board;
+    board.makeMove(2, 2, Player::X);
+    SearchResult result = searchBestMove(board, Player::O, lazySmp(4, 4));
+    ASSERT_EQ(result.threads.size(), 4u);
+    EXPECT_EQ(result.depth, 4);
+    EXPECT_EQ(result.threads[0].depth, 4);
+    for (const ThreadStats& stats : result.threads) {
+        EXPECT_GT(stats.nodes, 0u);
+        EXPECT_GE(stats.nodesPerSecond(), 0.0);
+    }
+    EXPECT_TRUE(board.isValidMove(result.move.first, result.move.second));
+}
+
+// Test a depth-limited search still sees a forced win on a large board
+TEST(EngineTest, LazySmpFindsWinOnLargeBoard) {
+    BasicBoard<6, 4> board;
+    // X X X _ on row 3, O scattered
+    board.makeMove(3, 0, Player::X);
+    board.makeMove(0, 5, Player::O);
+    board.makeMove(3, 1, Player::X);
+    board.makeMove(5, 5, Player::O);
+    board.makeMove(3, 2, Player::X);
+    board.makeMove(0, 0, Player::O);
+    SearchResult result = searchBestMove(board, Player::X, lazySmp(2, 3));
+    EXPECT_EQ(result.move, std::make_pair(3, 3));
+    EXPECT_EQ(result.score, MATE_SCORE - 1);
+}
+
+// Test the default engine is the exhaustive one and a finished game has no move
+TEST(EngineTest, MinimaxEngineAndFinishedGame) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    EXPECT_EQ(searchBestMove(board, Player::X).move, findBestMove(board, Player::X));
+
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(2, 2, Player::O);
+    board.makeMove(0, 2, Player::X);
+    EXPECT_EQ(searchBestMove(board, Player::O).move, std::make_pair(-1, -1));
+    SearchResult result = searchBestMove(board, Player::O, lazySmp(2));
+    EXPECT_EQ(result.move, std::make_pair(-1, -1));
+    EXPECT_EQ(result.threads.size(), 2u);
+}
+
+// plain fixed-depth negamax with no pruning, as the reference for PVS
+template <typename BoardT>
+static int referenceNegamax(BoardT& board, Player toMove, int depth, int ply) {
+    if (board.winner() != Player::None) return -(MATE_SCORE - ply);
+    if (board.isFull()) return 0;
+    if (depth == 0) return evaluate(board, toMove);
+    int best = -INFINITE_SCORE;
+    for (int cell : board.emptyCells()) {
+        board.makeMove(cell, toMove);
+        best = std::max(best, -referenceNegamax(board, otherPlayer(toMove), depth - 1, ply + 1));
+        board.undoMove();
+    }
+    return best;
+}
+
+// Test PVS re-searches and aspiration windows leave the score unchanged
+TEST(EngineTest, NegamaxMatchesUnprunedSearch) {
+    const int openings[][4] = { {12, 6, 7, 18}, {0, 24, 4, 20}, {12, 13, 8, 16}, {1, 2, 3, 11} };
+    for (const auto& cells : openings) {
+        BasicBoard<5, 4> board;
+        Player p = Player::X;
+        for (int cell : cells) {
+            board.makeMove(cell, p);
+            p = otherPlayer(p);
+        }
+        SearchOptions options;
+        options.engine = Engine::Negamax;
+        options.maxDepth = 3;
+        SearchResult result = searchBestMove(board, p, options);
+        EXPECT_EQ(result.score, referenceNegamax(board, p, 3, 0));
+        EXPECT_EQ(result.depth, 3);
+        ASSERT_EQ(result.threads.size(), 1u);
+
+        // the move played scores what the root claims
+        board.makeMove(result.move.first, result.move.second, p);
+        EXPECT_EQ(-referenceNegamax(board, otherPlayer(p), 2, 1), result.score);
+    }
+}
+
+// Test the single-threaded negamax plays 3x3 perfectly from the start
+TEST(EngineTest, NegamaxSelfPlayDraws) {
+    SearchOptions options;
+    options.engine = Engine::Negamax;
+    Board board;
+    Player p = Player::X;
+    while (!board.isGameOver()) {
+        SearchResult result = searchBestMove(board, p, options);
+        ASSERT_EQ(result.score, 0);
+        board.makeMove(result.move.first, result.move.second, p);
+        p = otherPlayer(p);
+    }
+    EXPECT_EQ(board.winner(), Player::None);
+}
+
+// Test the ordering prior counts the same lines the boards do
+TEST(EngineTest, LinesThroughCellMatchesBoardTables) {
+    EXPECT_EQ(linesThroughCell(3, 3, 1, 1), 4);  // center
+    EXPECT_EQ(linesThroughCell(3, 3, 0, 0), 3);  // corner
+    EXPECT_EQ(linesThroughCell(3, 3, 0, 1), 2);  // edge
+    for (int cell = 0; cell < 25; ++cell)
+        EXPECT_EQ(linesThroughCell(5, 4, cell / 5, cell % 5), (BOARD_TABLES<5, 4>.cellLineCount[cell]));
+    for (int cell = 0; cell < 36; ++cell)
+        EXPECT_EQ(linesThroughCell(6, 3, cell / 6, cell % 6), (BOARD_TABLES<6, 3>.cellLineCount[cell]));
+}
+
+// Test ordering changes how much is searched, not what is found
+TEST(EngineTest, MoveOrderingKeepsScoresAndCutsNodes) {
+    BasicBoard<5, 4> board;
+    board.makeMove(2, 2, Player::X);
+    board.makeMove(1, 1, Player::O);
+    SearchOptions options;
+    options.engine = Engine::Negamax;
+    options.maxDepth = 5;
+    SearchResult ordered = searchBestMove(board, Player::X, options);
+    options.moveOrdering = false;
+    SearchResult plain = searchBestMove(board, Player::X, options);
+    EXPECT_EQ(ordered.score, plain.score);
+    EXPECT_LT(ordered.threads[0].nodes, plain.threads[0].nodes);
+    EXPECT_GT(ordered.threads[0].cutoffs, 0u);
+    EXPECT_LE(ordered.threads[0].firstMoveCutoffs, ordered.threads[0].cutoffs);
+}
+
+// Test a deadline bounds the search time and still yields a legal move
+TEST(EngineTest, DeadlineReturnsLastCompletedDepth) {
+    BasicBoard<7, 5> board;  // far too big to search to the end
+    board.makeMove(3, 3, Player::X);
+    auto start = std::chrono::steady_clock::now();
+    SearchResult result = findBestMoveWithin(board, Player::O, std::chrono::milliseconds(50));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_TRUE(result.timedOut);
+    EXPECT_GE(result.depth, 1);
+    EXPECT_LT(result.depth, 48);
+    EXPECT_TRUE(board.isValidMove(result.move.first, result.move.second));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(500));
+}
+
+// Test a deadline that is never reached changes nothing
+TEST(EngineTest, GenerousDeadlineSearchesToTheEnd) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    SearchResult result = findBestMoveWithin(board, Player::O, std::chrono::milliseconds(10000));
+    EXPECT_FALSE(result.timedOut);
+    EXPECT_EQ(result.depth, 8);
+    EXPECT_EQ(result.score, 0);
+    EXPECT_EQ(result.move, std::make_pair(1, 1));  // only the center holds the draw
+}
+
+// Test even an already expired deadline gives a move (depth 1 always runs)
+TEST(EngineTest, ExpiredDeadlineStillMoves) {
+    BasicBoard<9, 5> board;
+    SearchOptions options;
+    options.engine = Engine::LazySmp;
+    options.threads = 2;
+    options.timeLimit = std::chrono::milliseconds(1);
+    SearchResult result = searchBestMove(board, Player::X, options);
+    EXPECT_GE(result.depth, 1);
+    EXPECT_TRUE(board.isValidMove(result.move.first, result.move.second));
+}
+
+// Test the same node budget always gives the same answer for the same work
+TEST(EngineTest, NodeBudgetIsReproducible) {
+    BasicBoard<6, 4> board;
+    board.makeMove(2, 2, Player::X);
+    board.makeMove(3, 3, Player::O);
+    SearchResult first = findBestMoveWithNodes(board, Player::X, 20000);
+    EXPECT_TRUE(first.outOfNodes);
+    EXPECT_FALSE(first.timedOut);
+    EXPECT_GE(first.depth, 1);
+    EXPECT_LE(first.threads[0].nodes, 20001u);
+    EXPECT_TRUE(board.isValidMove(first.move.first, first.move.second));
+    for (int run = 0; run < 3; ++run) {
+        SearchResult again = findBestMoveWithNodes(board, Player::X, 20000);
+        EXPECT_EQ(again.move, first.move);
+        EXPECT_EQ(again.score, first.score);
+        EXPECT_EQ(again.depth, first.depth);
+        EXPECT_EQ(again.threads[0].nodes, first.threads[0].nodes);
+    }
+
+    // a bigger budget gets at least as deep
+    EXPECT_GE(findBestMoveWithNodes(board, Player::X, 200000).depth, first.depth);
+}
+
+// Test a tiny budget still completes depth 1, a large one runs to the end
+TEST(EngineTest, NodeBudgetExtremes) {
+    BasicBoard<5, 4> board;
+    SearchResult tiny = findBestMoveWithNodes(board, Player::X, 1);
+    EXPECT_EQ(tiny.depth, 1);
+    EXPECT_TRUE(tiny.outOfNodes);
+    EXPECT_TRUE(board.isValidMove(tiny.move.first, tiny.move.second));
+
+    Board small;
+    small.makeMove(1, 1, Player::X);
+    SearchResult full = findBestMoveWithNodes(small, Player::O, 1000000);
+    EXPECT_FALSE(full.outOfNodes);
+    EXPECT_EQ(full.depth, 8);
+    EXPECT_EQ(full.score, 0);
+}
+
+// Test an async search gives the blocking search's answer
+TEST(EngineTest, AsyncSearchMatchesBlocking) {
+    ThreadPool pool(1);
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(0, 1, Player::X);
+    auto control = std::make_shared<SearchControl>();
+    std::future<SearchResult> pending = findBestMoveAsync(pool, board, Player::O, control);
+    board.reset();  // the search has its own copy
+    SearchResult result = pending.get();
+    EXPECT_EQ(result.move, std::make_pair(0, 2));
+    EXPECT_FALSE(result.cancelled);
+
+    SearchOptions options;
+    options.engine = Engine::Negamax;
+    control = std::make_shared<SearchControl>();
+    board.makeMove(1, 1, Player::X);
+    result = findBestMoveAsync(pool, board, Player::O, control, options).get();
+    EXPECT_EQ(result.depth, 8);
+    EXPECT_EQ(control->depth.load(), 8);
+}
+
+// Test cancelling stops searches that would otherwise run for a very long
+// time, on every engine, and progress shows up while they run
+TEST(EngineTest, CancelStopsAsyncSearch) {
+    ThreadPool pool(1);
+    BasicBoard<6, 5> board;
+    SearchOptions negamax;
+    negamax.engine = Engine::Negamax;
+    SearchOptions lazy = lazySmp(2);
+    SearchOptions mcts;
+    mcts.engine = Engine::Mcts;
+    mcts.playouts = 2000000;
+    SearchOptions parallelMcts = mcts;
+    parallelMcts.threads = 2;
+
+    for (const SearchOptions& options : {negamax, lazy, mcts, parallelMcts}) {
+        auto control = std::make_shared<SearchControl>();
+        std::future<SearchResult> pending = findBestMoveAsync(pool, board, Player::X, control, options);
+        while (control->nodes.load() == 0) std::this_thread::yield();
+        control->cancel();
+        ASSERT_EQ(pending.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+        SearchResult result = pending.get();
+        EXPECT_TRUE(result.cancelled);
+        EXPECT_FALSE(result.timedOut);
+    }
+}
+
+// Test a search cancelled before it starts returns at once without a move
+TEST(EngineTest, CancelBeforeStart) {
+    ThreadPool pool(1);
+    BasicBoard<7, 5> board;
+    auto control = std::make_shared<SearchControl>();
+    control->cancel();
+    SearchOptions options;
+    options.engine = Engine::Minimax;  // would never finish on 7x7
+    SearchResult result = findBestMoveAsync(pool, board, Player::X, control, options).get();
+    EXPECT_TRUE(result.cancelled);
+    EXPECT_EQ(result.move, std::make_pair(-1, -1));
+}
+
+// Test a caller-owned table carries work from one move to the next
+TEST(EngineTest, CallerTableIsReused) {
+    BasicBoard<4, 4> board;
+    board.makeMove(5, Player::X);
+    board.makeMove(10, Player::O);
+    SharedTranspositionTable table(size_t(1) << 18);
+    SearchOptions options;
+    options.engine = Engine::Negamax;
+    options.maxDepth = 6;
+    options.tableEntries = table.size();
+    options.table = &table;
+    SearchResult first = searchBestMove(board, Player::X, options);
+    SearchResult second = searchBestMove(board, Player::X, options);
+    EXPECT_EQ(second.score, first.score);
+    EXPECT_LT(second.threads[0].nodes, first.threads[0].nodes);
+
+    options.table = nullptr;  // a fresh table each call starts cold again
+    EXPECT_EQ(searchBestMove(board, Player::X, options).threads[0].nodes, first.threads[0].nodes);
+}
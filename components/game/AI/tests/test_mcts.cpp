@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "Engine.h"
+#include "Mcts.h"
+#include "Tablebase.h"
+
+// Test MCTS takes an immediate win
+TEST(MctsTest, TakesImmediateWin) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(1, 1, Player::O);
+    Mcts<Board> mcts;
+    MctsResult result = mcts.search(board, Player::X);
+    EXPECT_EQ(result.cell, 2);
+    EXPECT_GT(result.winRate, 0.9);
+}
+
+// Test MCTS blocks a threat on a larger board
+TEST(MctsTest, BlocksOnLargerBoard) {
+    BasicBoard<5, 4> board;
+    board.makeMove(2, 0, Player::X);
+    board.makeMove(0, 0, Player::O);
+    board.makeMove(2, 1, Player::X);
+    board.makeMove(0, 4, Player::O);
+    board.makeMove(2, 2, Player::X);
+    // X X X _ _ on row 2: only (2,3) stops four in a row
+    MctsOptions options;
+    options.iterations = 20000;
+    Mcts<BasicBoard<5, 4>> mcts(options);
+    MctsResult result = mcts.search(board, Player::O);
+    EXPECT_EQ(result.cell, 2 * 5 + 3);
+}
+
+// Test the same seed gives the same search, a different one may not
+TEST(MctsTest, SeedMakesSearchReproducible) {
+    BasicBoard<6, 4> board;
+    board.makeMove(2, 2, Player::X);
+    MctsOptions options;
+    options.iterations = 3000;
+    options.seed = 7;
+    Mcts<BasicBoard<6, 4>> first(options);
+    Mcts<BasicBoard<6, 4>> second(options);
+    MctsResult a = first.search(board, Player::O);
+    MctsResult b = second.search(board, Player::O);
+    EXPECT_EQ(a.cell, b.cell);
+    EXPECT_EQ(a.visits, b.visits);
+    EXPECT_EQ(first.search(board, Player::O).visits, a.visits);  // reused engine
+}
+
+// Test the pool is sized up front: one node per playout plus the root
+TEST(MctsTest, OneNodePerIteration) {
+    BasicBoard<7, 5> board;
+    MctsOptions options;
+    options.iterations = 500;
+    Mcts<BasicBoard<7, 5>> mcts(options);
+    MctsResult result = mcts.search(board, Player::X);
+    EXPECT_EQ(result.iterations, 500);
+    EXPECT_EQ(result.nodesUsed, 501u);
+    EXPECT_TRUE(board.isValidMove(result.cell / 7, result.cell % 7));
+
+    board.makeMove(0, 0, Player::X);  // reuse for the next move
+    EXPECT_EQ(mcts.search(board, Player::O).nodesUsed, 501u);
+}
+
+// Test batched leaves: every iteration counts leafPlayouts games, on the
+// SIMD path for 3x3 and the scalar one for bigger boards
+TEST(MctsTest, LeafPlayoutsBatchGames) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(0, 1, Player::X);
+    MctsOptions options;
+    options.iterations = 400;
+    options.leafPlayouts = 16;
+    Mcts<Board> mcts(options);
+    MctsResult result = mcts.search(board, Player::O);
+    EXPECT_EQ(result.cell, 2);  // block the top row
+    EXPECT_EQ(result.iterations, 400);
+    EXPECT_EQ(result.visits % 16, 0u);
+
+    BasicBoard<5, 4> big;
+    options.iterations = 200;
+    options.leafPlayouts = 4;
+    MctsResult bigResult = Mcts<BasicBoard<5, 4>>(options).search(big, Player::X);
+    EXPECT_EQ(bigResult.iterations, 200);
+    EXPECT_EQ(bigResult.visits % 4, 0u);
+}
+
+// Test self-play on 3x3 with enough playouts is a draw, via the engine switch
+TEST(MctsTest, EngineSelfPlayDraws) {
+    SearchOptions options;
+    options.engine = Engine::Mcts;
+    options.playouts = 20000;
+    Board board;
+    Player p = Player::X;
+    while (!board.isGameOver()) {
+        SearchResult result = searchBestMove(board, p, options);
+        int value = perfectMove(board, p).score;
+        ASSERT_TRUE(board.makeMove(result.move.first, result.move.second, p));
+        // the move keeps the game-theoretic value (draw stays a draw)
+        EXPECT_EQ(value >= 0, perfectMove(board, otherPlayer(p)).score <= 0);
+        p = otherPlayer(p);
+    }
+    EXPECT_EQ(board.winner(), Player::None);
+}
+
+// Test a finished game gives no move
+TEST(MctsTest, FinishedGame) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(0, 2, Player::X);
+    Mcts<Board> mcts;
+    EXPECT_EQ(mcts.search(board, Player::O).cell, -1);
+
+    // no iterations ran, but nothing timed out either
+    SearchOptions options;
+    options.engine = Engine::Mcts;
+    SearchResult result = searchBestMove(board, Player::O, options);
+    EXPECT_FALSE(result.timedOut);
+    options.threads = 2;
+    EXPECT_FALSE(searchBestMove(board, Player::O, options).timedOut);
+}
+
+// Test only a time limit that stops the search counts as timing out
+TEST(MctsTest, TimeLimitReportsTimeout) {
+    BasicBoard<9, 5> board;
+    SearchOptions options;
+    options.engine = Engine::Mcts;
+    options.playouts = 1000000;
+    options.timeLimit = std::chrono::milliseconds(10);
+    SearchResult limited = searchBestMove(board, Player::X, options);
+    EXPECT_TRUE(limited.timedOut);
+    EXPECT_LT(limited.threads[0].nodes, 1000000u);
+
+    options.playouts = 200;
+    options.timeLimit = std::chrono::milliseconds(10000);
+    EXPECT_FALSE(searchBestMove(board, Player::X, options).timedOut);
+}
+
+// Test an engine given new options searches like a fresh one, and the
+// engine switch gives the same move with a fresh or a caller's engine
+TEST(MctsTest, SetOptionsReusesEngine) {
+    BasicBoard<5, 4> board;
+    board.makeMove(2, 2, Player::X);
+    MctsOptions small;
+    small.iterations = 300;
+    MctsOptions large;
+    large.iterations = 2000;
+    large.seed = 11;
+
+    Mcts<BasicBoard<5, 4>> reused(small);
+    reused.search(board, Player::O);
+    reused.setOptions(large);
+    MctsResult a = reused.search(board, Player::O);
+    MctsResult b = Mcts<BasicBoard<5, 4>>(large).search(board, Player::O);
+    EXPECT_EQ(a.cell, b.cell);
+    EXPECT_EQ(a.visits, b.visits);
+    EXPECT_EQ(a.nodesUsed, 2001u);
+    reused.setOptions(small);  // shrinking keeps the pool
+    EXPECT_EQ(reused.search(board, Player::O).iterations, 300);
+
+    SearchOptions options;
+    options.engine = Engine::Mcts;
+    options.playouts = 2000;
+    options.seed = 11;
+    std::pair<int, int> expected = {b.cell / 5, b.cell % 5};
+    EXPECT_EQ(searchBestMove(board, Player::O, options).move, expected);  // fresh engine
+
+    options.mcts = &reused;  // the caller's engine, pool and all
+    EXPECT_EQ(searchBestMove(board, Player::O, options).move, expected);
+    EXPECT_EQ(searchBestMove(board, Player::O, options).move, expected);
+
+    Mcts<BasicBoard<6, 4>> otherBoard;
+    options.mcts = &otherBoard;  // wrong board type: ignored
+    EXPECT_EQ(searchBestMove(board, Player::O, options).move, expected);
+}
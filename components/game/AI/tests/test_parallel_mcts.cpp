@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "Engine.h"
+#include "ParallelMcts.h"
+
+// Test every requested playout runs and each adds one node
+TEST(ParallelMctsTest, RunsEveryPlayout) {
+    BasicBoard<7, 5> board;
+    board.makeMove(3, 3, Player::X);
+    MctsOptions options;
+    options.iterations = 5000;
+    ParallelMcts<BasicBoard<7, 5>> mcts(options, 8);
+    MctsResult result = mcts.search(board, Player::O);
+    EXPECT_EQ(result.iterations, 5000);
+    EXPECT_EQ(result.nodesUsed, 5001u);
+    EXPECT_TRUE(board.isValidMove(result.cell / 7, result.cell % 7));
+    EXPECT_LE(result.visits, 5000u);
+
+    board.makeMove(result.cell, Player::O);  // reuse for the next move
+    EXPECT_EQ(mcts.search(board, Player::X).iterations, 5000);
+}
+
+// Test threads sharing the tree still find forced moves
+TEST(ParallelMctsTest, FindsWinAndBlock) {
+    MctsOptions options;
+    options.iterations = 20000;
+
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(1, 1, Player::O);
+    ParallelMcts<Board> small(options, 4);
+    EXPECT_EQ(small.search(board, Player::X).cell, 2);  // win
+    EXPECT_EQ(small.search(board, Player::O).cell, 5);  // O wins too
+
+    BasicBoard<5, 4> large;
+    large.makeMove(2, 0, Player::X);
+    large.makeMove(0, 0, Player::O);
+    large.makeMove(2, 1, Player::X);
+    large.makeMove(0, 4, Player::O);
+    large.makeMove(2, 2, Player::X);
+    ParallelMcts<BasicBoard<5, 4>> mcts(options, 4);
+    EXPECT_EQ(mcts.search(large, Player::O).cell, 2 * 5 + 3);  // block
+}
+
+// Test the engine switch uses the tree-parallel search for several threads
+TEST(ParallelMctsTest, EngineSelectsParallelSearch) {
+    SearchOptions options;
+    options.engine = Engine::Mcts;
+    options.threads = 4;
+    options.playouts = 2000;
+    BasicBoard<6, 4> board;
+    SearchResult result = searchBestMove(board, Player::X, options);
+    EXPECT_TRUE(board.isValidMove(result.move.first, result.move.second));
+    EXPECT_EQ(result.threads[0].nodes, 2000u);
+    EXPECT_FALSE(result.timedOut);
+}
+
+// Test a time limit stops all threads early
+TEST(ParallelMctsTest, TimeLimitStopsEarly) {
+    BasicBoard<9, 5> board;
+    MctsOptions options;
+    options.iterations = 1000000;
+    options.timeLimit = std::chrono::milliseconds(10);
+    ParallelMcts<BasicBoard<9, 5>> mcts(options, 4);
+    auto start = std::chrono::steady_clock::now();
+    MctsResult result = mcts.search(board, Player::X);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+    EXPECT_GT(result.iterations, 0);
+    EXPECT_LT(result.iterations, options.iterations);
+    EXPECT_GE(result.cell, 0);
+}
+
+// Test batched leaves add their extra games to the visit counts
+TEST(ParallelMctsTest, LeafPlayoutsCountEveryGame) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(0, 1, Player::X);
+    MctsOptions options;
+    options.iterations = 2000;
+    options.leafPlayouts = 8;
+    MctsResult result = ParallelMcts<Board>(options, 4).search(board, Player::O);
+    EXPECT_EQ(result.cell, 2);
+    EXPECT_EQ(result.iterations, 2000);
+    EXPECT_EQ(result.visits % 8, 0u);
+}
+
+// Test each thread gets its own random stream, not a shifted copy of
+// another thread's
+TEST(ParallelMctsTest, ThreadStreamsAreIndependent) {
+    const int DRAWS = 64;
+    uint64_t first[4][DRAWS];
+    for (unsigned id = 0; id < 4; ++id) {
+        uint64_t rng = ParallelMcts<Board>::threadSeed(ZOBRIST_SEED, id);
+        for (uint64_t& draw : first[id]) draw = splitMix64(rng);
+    }
+    for (unsigned a = 0; a < 4; ++a) {
+        for (unsigned b = 0; b < 4; ++b) {
+            if (a == b) continue;
+            for (int shift = 0; shift < DRAWS; ++shift)
+                EXPECT_NE(first[a][0], first[b][shift]) << "thread " << a << " replays thread " << b;
+        }
+    }
+}
+
+// Test the engine switch searches on a caller's parallel engine
+TEST(ParallelMctsTest, EngineUsesCallersEngine) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(0, 1, Player::X);
+    ParallelMcts<Board> engine(MctsOptions{}, 2);
+    SearchOptions options;
+    options.engine = Engine::Mcts;
+    options.playouts = 5000;
+    options.mcts = &engine;
+    for (int move = 0; move < 2; ++move) {
+        SearchResult result = searchBestMove(board, Player::O, options);
+        EXPECT_EQ(result.move, std::make_pair(0, 2));  // block
+        EXPECT_EQ(result.threads[0].nodes, 5000u);
+    }
+    EXPECT_EQ(engine.threadCount(), 2u);
+}
@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+#include "ParallelSearch.h"
+#include "PositionIndex.h"
+
+// Test the parallel search picks exactly the serial move on 3x3 positions
+TEST(ParallelSearchTest, MatchesSerialOn3x3) {
+    ThreadPool pool(4);
+    for (int index = 0; index < POSITION_COUNT; index += 5) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        if (board.isGameOver()) continue;
+        Player p = (board.moveCount() % 2 == 0) ? Player::X : Player::O;
+        ASSERT_EQ(findBestMoveParallel(board, p, pool), findBestMove<Board>(board, p)) << "index " << index;
+    }
+}
+
+// Test repeated runs agree however the threads are scheduled
+TEST(ParallelSearchTest, DeterministicOn4x4) {
+    BasicBoard<4, 3> board;
+    // X O _ _
+    // _ X _ _
+    // _ O _ _
+    // _ _ _ _
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(0, 1, Player::O);
+    board.makeMove(1, 1, Player::X);
+    board.makeMove(2, 1, Player::O);
+    TranspositionTable table;
+    auto serial = findBestMove(board, Player::X, &table);
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        ThreadPool pool(threads);
+        for (int run = 0; run < 3; ++run)
+            EXPECT_EQ(findBestMoveParallel(board, Player::X, pool), serial) << threads << " threads";
+    }
+}
+
+// Test the shortcuts: center on an empty board, immediate wins
+TEST(ParallelSearchTest, Shortcuts) {
+    ThreadPool pool(2);
+    BasicBoard<4, 4> empty;
+    EXPECT_EQ(findBestMoveParallel(empty, Player::X, pool), std::make_pair(2, 2));
+
+    Board board;
+    board.makeMove(0, 0, Player::O);
+    board.makeMove(1, 1, Player::X);
+    board.makeMove(0, 1, Player::O);
+    board.makeMove(2, 2, Player::X);
+    EXPECT_EQ(findBestMoveParallel(board, Player::O, pool), std::make_pair(0, 2));
+}
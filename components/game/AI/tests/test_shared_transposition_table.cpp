@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "SharedTranspositionTable.h"
+#include "Zobrist.h"
+
+// Test an entry comes back exactly as stored, including negative scores
+TEST(SharedTranspositionTableTest, StoreThenProbe) {
+    SharedTranspositionTable table(1024);
+    table.store(0x1234, -987654321, Bound::Lower, 42, 17);
+    SharedEntry entry;
+    ASSERT_TRUE(table.probe(0x1234, entry));
+    EXPECT_EQ(entry.score, -987654321);
+    EXPECT_EQ(entry.bestMove, 42);
+    EXPECT_EQ(entry.depth, 17);
+    EXPECT_EQ(entry.bound, Bound::Lower);
+
+    table.store(0x5678, 3, Bound::Exact, -1, 0);
+    ASSERT_TRUE(table.probe(0x5678, entry));
+    EXPECT_EQ(entry.bestMove, -1);
+}
+
+// Test empty slots, other keys in the same slot and clear() all miss
+TEST(SharedTranspositionTableTest, Misses) {
+    SharedTranspositionTable table(1000);
+    EXPECT_EQ(table.size(), 1024u);
+    SharedEntry entry;
+    EXPECT_FALSE(table.probe(0, entry));  // key 0 on an empty slot
+    table.store(5, 1, Bound::Exact, 0, 1);
+    EXPECT_FALSE(table.probe(5 + 1024, entry));
+    table.clear();
+    EXPECT_FALSE(table.probe(5, entry));
+}
+
+// Test a shallower result does not replace a deeper one for the same key
+TEST(SharedTranspositionTableTest, KeepsDeeperEntry) {
+    SharedTranspositionTable table(16);
+    table.store(7, 100, Bound::Exact, 3, 9);
+    table.store(7, 50, Bound::Exact, 4, 2);
+    SharedEntry entry;
+    ASSERT_TRUE(table.probe(7, entry));
+    EXPECT_EQ(entry.score, 100);
+    table.store(7 + 16, 50, Bound::Exact, 4, 2);  // different position: replaces
+    EXPECT_FALSE(table.probe(7, entry));
+}
+
+// Test concurrent writers never produce an entry that mixes two writes.
+// Keys are random 64-bit values (all in slot 3) and each score is a hash
+// of its key, so a torn slot can't pass for a real entry by accident.
+TEST(SharedTranspositionTableTest, ConcurrentWritesNeverTear) {
+    auto checksum = [](uint64_t key) {
+        return static_cast<int>(static_cast<uint32_t>(splitMix64(key)));
+    };
+    std::vector<uint64_t> keys(64);
+    uint64_t state = ZOBRIST_SEED;
+    for (uint64_t& key : keys) key = (splitMix64(state) & ~uint64_t(7)) | 3;
+
+    SharedTranspositionTable table(8);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&table, &keys, &checksum, t] {
+            for (int i = 0; i < 100000; ++i) {
+                uint64_t key = keys[(i + t * 16) % keys.size()];
+                table.store(key, checksum(key), Bound::Exact, t, 0);
+            }
+        });
+    }
+    for (int i = 0; i < 100000; ++i) {
+        uint64_t key = keys[i % keys.size()];
+        SharedEntry entry;
+        if (table.probe(key, entry)) {
+            // EXPECT, not ASSERT: the writers still have to be joined
+            EXPECT_EQ(entry.score, checksum(key)) << "key " << key;
+            EXPECT_GE(entry.bestMove, 0);
+            EXPECT_LT(entry.bestMove, 4);
+        }
+    }
+    for (std::thread& writer : writers) writer.join();
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include "AI.h"
+#include "Board.h"
+#include "PositionIndex.h"
+#include "Tablebase.h"
+
+// value of playing `cell` for p, searched live without a table, so the
+// check doesn't depend on the table code the generator uses
+static int searchedScore(const Board& board, int cell, Player p) {
+    Board work = board;
+    work.makeMove(cell, p);
+    return minimax(work, otherPlayer(p), p, std::numeric_limits<int>::min(),
+                   std::numeric_limits<int>::max(), 0);
+}
+
+// Test every generated entry against live minimax, for both sides to move
+TEST(TablebaseTest, MatchesMinimaxEverywhere) {
+    for (int index = 0; index < POSITION_COUNT; ++index) {
+        Board board = decodePosition(index);
+        for (Player p : {Player::X, Player::O}) {
+            PerfectMove best = perfectMove(board, p);
+            if (board.isGameOver()) {
+                ASSERT_EQ(best.cell, -1) << "index " << index;
+                continue;
+            }
+            ASSERT_TRUE(board.isCellEmpty(best.cell / 3, best.cell % 3)) << "index " << index;
+
+            int bestScore = std::numeric_limits<int>::min();
+            for (int cell : board.emptyCells())
+                bestScore = std::max(bestScore, searchedScore(board, cell, p));
+            ASSERT_EQ(best.score, bestScore) << "index " << index;
+            ASSERT_EQ(searchedScore(board, best.cell, p), bestScore) << "index " << index;
+        }
+    }
+}
+
+// Test the table needs no special cases: center opening, no move after the end
+TEST(TablebaseTest, OpeningAndFinishedGame) {
+    Board board;
+    EXPECT_EQ(perfectMove(board, Player::X).cell, 4);
+    EXPECT_EQ(perfectMove(board, Player::X).score, 0);  // perfect play draws
+
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(0, 2, Player::X);
+    EXPECT_EQ(findBestMove(board, Player::O), std::make_pair(-1, -1));
+}
+
+// Test the byte encoding round-trips every possible entry
+TEST(TablebaseTest, EntryEncodingRoundTrips) {
+    for (int cell = -1; cell < 9; ++cell) {
+        for (int score = -10; score <= 10; ++score) {
+            PerfectMove back = decodeTablebaseEntry(encodeTablebaseEntry({ cell, score }));
+            EXPECT_EQ(back.cell, cell);
+            EXPECT_EQ(back.score, score);
+        }
+    }
+}
+
+// Test the table-backed analysis against the searched one on every position
+TEST(TablebaseTest, AnalysisMatchesSearch) {
+    for (int index = 0; index < POSITION_COUNT; ++index) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        Player p = (board.moveCount() % 2 == 0) ? Player::X : Player::O;
+        auto fromTable = analyzePosition(board, p);
+        auto searched = analyzePosition<Board>(board, p, nullptr);  // table-free search
+        ASSERT_EQ(fromTable.size(), searched.size()) << "index " << index;
+        for (size_t i = 0; i < fromTable.size(); ++i) {
+            EXPECT_EQ(fromTable[i].row, searched[i].row);
+            EXPECT_EQ(fromTable[i].col, searched[i].col);
+            EXPECT_EQ(fromTable[i].score, searched[i].score) << "index " << index;
+            EXPECT_EQ(fromTable[i].outcome, searched[i].outcome);
+            EXPECT_EQ(fromTable[i].plies, searched[i].plies);
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include "ThreadPool.h"
+
+// Test submitted tasks run and hand back their results
+TEST(ThreadPoolTest, ReturnsResults) {
+    ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i)
+        results.push_back(pool.submit([i] { return i * i; }));
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(results[i].get(), i * i);
+}
+
+// Test the destructor runs every queued task before returning
+TEST(ThreadPoolTest, DrainsQueueOnDestruction) {
+    std::atomic<int> done(0);
+    {
+        ThreadPool pool(2);
+        for (int i = 0; i < 1000; ++i)
+            pool.submit([&done] { ++done; });
+    }
+    EXPECT_EQ(done.load(), 1000);
+}
+
+// Test a pool with no size given still has a worker
+TEST(ThreadPoolTest, DefaultSize) {
+    ThreadPool pool;
+    EXPECT_GE(pool.size(), 1u);
+    EXPECT_EQ(pool.submit([] { return 7; }).get(), 7);
+}
+
+// Test exceptions thrown by a task reach the caller
+TEST(ThreadPoolTest, PropagatesExceptions) {
+    ThreadPool pool(1);
+    auto result = pool.submit([]() -> int { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(result.get(), std::runtime_error);
+    EXPECT_EQ(pool.submit([] { return 1; }).get(), 1);  // worker survives
+}
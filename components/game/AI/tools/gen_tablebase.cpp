@@ -0,0 +1,63 @@
+// Solves every 3x3 position with minimax and writes the result as a C++
+// header for Tablebase.cpp. Run by the build: gen_tablebase <output header>
+#include "AI.h"
+#include "PositionIndex.h"
+#include "Tablebase.h"
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+namespace {
+
+// tie-break order for equally scored moves: center, corners, edges
+constexpr int MOVE_ORDER[9] = {4, 0, 2, 6, 8, 1, 3, 5, 7};
+
+// best move and score for `toMove`, the way findBestMove scores its root
+PerfectMove solve(const Board& board, Player toMove, TranspositionTable& table) {
+    PerfectMove best = { -1, 0 };
+    if (board.isGameOver()) return best;
+
+    Board work = board;
+    best.score = std::numeric_limits<int>::min();
+    for (int cell : MOVE_ORDER) {
+        if (!work.makeMove(cell, toMove)) continue;
+        int score = minimax(work, otherPlayer(toMove), toMove,
+                            std::numeric_limits<int>::min(),
+                            std::numeric_limits<int>::max(), 0, &table);
+        work.undoMove();
+        if (score > best.score) {
+            best = { cell, score };
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc != 2) {
+        std::cerr << "usage: gen_tablebase <output header>" << std::endl;
+        return 1;
+    }
+    std::ofstream out(argv[1]);
+    if (!out) {
+        std::cerr << "gen_tablebase: cannot write " << argv[1] << std::endl;
+        return 1;
+    }
+
+    out << "// generated by gen_tablebase, do not edit\n"
+        << "// [index][0] X to move, [1] O to move; encoding in Tablebase.h\n"
+        << "static const uint8_t TABLEBASE_DATA[" << POSITION_COUNT << "][2] = {\n";
+    TranspositionTable table(size_t(1) << 18);
+    for (int index = 0; index < POSITION_COUNT; ++index) {
+        Board board = decodePosition(index);
+        out << "{";
+        for (Player p : {Player::X, Player::O}) {
+            PerfectMove best = solve(board, p, table);
+            out << static_cast<int>(encodeTablebaseEntry(best)) << (p == Player::X ? "," : "");
+        }
+        out << (index + 1 < POSITION_COUNT ? "}," : "}") << ((index % 8 == 7) ? "\n" : "");
+    }
+    out << "\n};\n";
+    return out ? 0 : 1;
+}
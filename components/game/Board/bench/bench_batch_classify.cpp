@@ -0,0 +1,68 @@
+// Throughput of batch position classification against Board::checkWinner.
+// Usage: bench_batch_classify [positions]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Board.h"
+#include "BatchClassify.h"
+#include "PositionIndex.h"
+
+namespace {
+
+template <typename Fn>
+double positionsPerSecond(size_t count, int rounds, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(count) * rounds / elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t count = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const int rounds = 10;
+
+    // random legal positions, as a replay job would see them
+    std::vector<int> reachable;
+    for (int index = 0; index < POSITION_COUNT; ++index)
+        if (isReachablePosition(index)) reachable.push_back(index);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> pick(0, reachable.size() - 1);
+    std::vector<uint32_t> packed(count);
+    std::vector<Board> boards(count);
+    for (size_t i = 0; i < count; ++i) {
+        boards[i] = decodePosition(reachable[pick(rng)]);
+        packed[i] = boards[i].packed();
+    }
+    std::vector<PositionStatus> status(count);
+
+    volatile int sink = 0;
+    double board = positionsPerSecond(count, rounds, [&] {
+        int wins = 0;
+        for (const Board& b : boards) wins += b.checkWinner().winner != Player::None;
+        sink = sink + wins;
+    });
+    double rebuild = positionsPerSecond(count, rounds, [&] {
+        int wins = 0;
+        for (uint32_t p : packed) wins += Board::fromPacked(p).checkWinner().winner != Player::None;
+        sink = sink + wins;
+    });
+    double scalar = positionsPerSecond(count, rounds, [&] {
+        classifyPositionsScalar(packed.data(), count, status.data());
+    });
+    double batch = positionsPerSecond(count, rounds, [&] {
+        classifyPositions(packed.data(), count, status.data());
+    });
+
+    std::printf("positions: %zu x %d rounds\n", count, rounds);
+    std::printf("%-36s %10.1f M/s\n", "Board::checkWinner (built boards)", board / 1e6);
+    std::printf("%-36s %10.1f M/s\n", "fromPacked + checkWinner", rebuild / 1e6);
+    std::printf("%-36s %10.1f M/s\n", "classifyPositionsScalar", scalar / 1e6);
+    std::printf("%-36s %10.1f M/s\n",
+                batchClassifyUsesAvx2() ? "classifyPositions (avx2)" : "classifyPositions (scalar)",
+                batch / 1e6);
+    return 0;
+}
@@ -0,0 +1,57 @@
+// Random 3x3 games per second: Board::makeMove loop, scalar bitboard
+// loop and the SIMD kernel.
+// Usage: bench_random_playouts [games]
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include "Board.h"
+#include "RandomPlayouts.h"
+
+namespace {
+
+template <typename Fn>
+double gamesPerSecond(uint64_t games, Fn&& fn) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<double>(games) / elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    uint64_t games = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 4000000;
+
+    volatile uint64_t sink = 0;
+    double board = gamesPerSecond(games, [&] {
+        std::mt19937 rng(42);
+        uint64_t xWins = 0;
+        for (uint64_t g = 0; g < games; ++g) {
+            Board b;
+            Player p = Player::X;
+            while (!b.isGameOver()) {
+                int cells[9];
+                int count = 0;
+                for (int cell : b.emptyCells()) cells[count++] = cell;
+                b.makeMove(cells[rng() % count], p);
+                p = (p == Player::X) ? Player::O : Player::X;
+            }
+            xWins += b.checkWinner().winner == Player::X;
+        }
+        sink = sink + xWins;
+    });
+    double scalar = gamesPerSecond(games, [&] {
+        sink = sink + randomPlayoutsScalar(0, Player::X, games, 42).xWins;
+    });
+    double kernel = gamesPerSecond(games, [&] {
+        sink = sink + randomPlayouts(0, Player::X, games, 42).xWins;
+    });
+
+    std::printf("games from the empty board: %llu\n", static_cast<unsigned long long>(games));
+    std::printf("%-36s %10.1f M/s\n", "Board::makeMove loop", board / 1e6);
+    std::printf("%-36s %10.1f M/s\n", "randomPlayoutsScalar", scalar / 1e6);
+    std::printf("%-36s %10.1f M/s  (%s)\n", "randomPlayouts", kernel / 1e6,
+                randomPlayoutsUseAvx2() ? "avx2" : "scalar fallback");
+    return 0;
+}
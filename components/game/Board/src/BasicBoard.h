@@ -0,0 +1,202 @@
+#ifndef BASIC_BOARD_H
+#define BASIC_BOARD_H
+
+#include "Board.h"
+#include "CellMask.h"
+#include "Zobrist.h"
+#include <array>
+#include <cstdint>
+#include <iostream>
+
+// Line and Zobrist tables for an N x N board where K in a row wins, built at
+// compile time. Lines are numbered rows first, then columns, diagonals and
+// anti-diagonals (the same order Board uses for 3x3).
+template <int N, int K>
+struct BoardTables {
+    static constexpr int CELLS = N * N;
+    static constexpr int LINES = 2 * N * (N - K + 1) + 2 * (N - K + 1) * (N - K + 1);
+    static constexpr int MAX_LINES_PER_CELL = 4 * K;
+
+    int16_t lineCells[LINES][K];                       // cells of each line
+    int16_t cellLines[CELLS][MAX_LINES_PER_CELL];      // lines through each cell
+    uint8_t cellLineCount[CELLS];
+    uint64_t zobrist[2][CELLS];                        // [0] X, [1] O per cell
+};
+
+template <int N, int K>
+constexpr BoardTables<N, K> makeBoardTables() {
+    BoardTables<N, K> t{};
+    // (row step, col step, first start col) for rows, cols, diags, anti-diags
+    constexpr int dirs[4][3] = { {0, 1, 0}, {1, 0, 0}, {1, 1, 0}, {1, -1, K - 1} };
+
+    int line = 0;
+    for (const auto& dir : dirs) {
+        int rowSpan = (dir[0] == 0) ? N : N - K + 1;
+        int colSpan = (dir[1] == 0) ? N : N - K + 1;
+        // columns walk col-major so column c's windows stay together
+        bool colMajor = (dir[0] == 1 && dir[1] == 0);
+        for (int a = 0; a < (colMajor ? colSpan : rowSpan); ++a) {
+            for (int b = 0; b < (colMajor ? rowSpan : colSpan); ++b) {
+                int r0 = colMajor ? b : a;
+                int c0 = (colMajor ? a : b) + dir[2];
+                for (int i = 0; i < K; ++i) {
+                    int cell = (r0 + i * dir[0]) * N + (c0 + i * dir[1]);
+                    t.lineCells[line][i] = static_cast<int16_t>(cell);
+                    t.cellLines[cell][t.cellLineCount[cell]++] = static_cast<int16_t>(line);
+                }
+                ++line;
+            }
+        }
+    }
+
+    uint64_t state = ZOBRIST_SEED;
+    for (int side = 0; side < 2; ++side)
+        for (int cell = 0; cell < N * N; ++cell)
+            t.zobrist[side][cell] = splitMix64(state);
+    return t;
+}
+
+template <int N, int K>
+inline constexpr BoardTables<N, K> BOARD_TABLES = makeBoardTables<N, K>();
+
+// N x N board where K in a row wins. Same interface as Board (minus the
+// 3x3-specific WinInfo/packed helpers), so search code can be generic.
+// Use BoardNK<N, K> below to get the bitboard Board for 3x3.
+template <int N, int K>
+class BasicBoard {
+    static_assert(N >= 2 && N <= 16, "board side must be 2..16");
+    static_assert(K >= 2 && K <= N, "win length must be 2..N");
+
+public:
+    static constexpr int SIZE = N;
+    static constexpr int WIN_LENGTH = K;
+    static constexpr int CELLS = N * N;
+    static constexpr int LINES = BoardTables<N, K>::LINES;
+
+    BasicBoard() { reset(); }
+
+    bool makeMove(int row, int col, Player p) {
+        if (row < 0 || row >= N || col < 0 || col >= N) return false;
+        return makeMove(row * N + col, p);
+    }
+
+    // same, addressed by cell index (row * N + col)
+    bool makeMove(int cell, Player p) {
+        if (cell < 0 || cell >= CELLS || !empty.test(cell) || p == Player::None) return false;
+        const auto& tables = BOARD_TABLES<N, K>;
+        int side = (p == Player::X) ? 0 : 1;
+        grid[cell] = p;
+        empty.reset(cell);
+        moveStack[movesMade++] = static_cast<int16_t>(cell);
+        zobrist ^= tables.zobrist[side][cell];
+
+        // only the lines through this cell can have been completed
+        for (int i = 0; i < tables.cellLineCount[cell]; ++i) {
+            int line = tables.cellLines[cell][i];
+            if (++lineCounts[side][line] == K && winLine < 0) {
+                winLine = line;
+                winPlayer = p;
+            }
+        }
+        return true;
+    }
+
+    // take back the last move made
+    bool undoMove() {
+        if (movesMade == 0) return false;
+        const auto& tables = BOARD_TABLES<N, K>;
+        int cell = moveStack[--movesMade];
+        int side = (grid[cell] == Player::X) ? 0 : 1;
+        grid[cell] = Player::None;
+        empty.set(cell);
+        zobrist ^= tables.zobrist[side][cell];
+
+        for (int i = 0; i < tables.cellLineCount[cell]; ++i)
+            --lineCounts[side][tables.cellLines[cell][i]];
+
+        // moves come back in order, so only the winning move can break winLine
+        int winSide = (winPlayer == Player::X) ? 0 : 1;
+        if (winLine >= 0 && lineCounts[winSide][winLine] < K) {
+            winLine = -1;
+            winPlayer = Player::None;
+        }
+        return true;
+    }
+
+    bool isValidMove(int row, int col) const {
+        return row >= 0 && row < N && col >= 0 && col < N && isCellEmpty(row, col);
+    }
+    bool isCellEmpty(int row, int col) const { return empty.test(row * N + col); }
+    Player cellAt(int row, int col) const { return grid[row * N + col]; }
+    bool isFull() const { return movesMade == CELLS; }
+
+    void reset() {
+        for (Player& cell : grid) cell = Player::None;
+        empty = CellMask<CELLS>();
+        for (int cell = 0; cell < CELLS; ++cell) empty.set(cell);
+        for (auto& counts : lineCounts)
+            for (uint8_t& count : counts)
+                count = 0;
+        movesMade = 0;
+        winLine = -1;
+        winPlayer = Player::None;
+        zobrist = 0;
+    }
+
+    void print() const {
+        for (int i = 0; i < N; ++i) {
+            for (int j = 0; j < N; ++j) {
+                std::cout << playerToChar(grid[i * N + j]) << " ";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    Player winner() const { return winPlayer; }
+    bool isGameOver() const { return winPlayer != Player::None || movesMade == CELLS; }
+    int moveCount() const { return movesMade; }
+    uint64_t hash() const { return zobrist; }
+
+    // legal moves: one bit per empty cell
+    CellMask<CELLS> emptyCells() const { return empty; }
+
+    // cells of the first completed line (only meaningful when winner() != None)
+    std::array<CellPos, K> winningCells() const {
+        std::array<CellPos, K> cells{};
+        if (winLine < 0) return cells;
+        for (int i = 0; i < K; ++i) {
+            int cell = BOARD_TABLES<N, K>.lineCells[winLine][i];
+            cells[i] = { cell / N, cell % N };
+        }
+        return cells;
+    }
+
+    // pieces of player p on line `line`, for evaluation functions
+    int lineCount(Player p, int line) const { return lineCounts[p == Player::X ? 0 : 1][line]; }
+
+private:
+    Player grid[CELLS];
+    CellMask<CELLS> empty;        // kept in step with grid
+    uint8_t lineCounts[2][LINES]; // pieces per player ([0] X, [1] O) on each line
+    int16_t moveStack[CELLS];     // cells in the order they were played
+    int movesMade;
+    int winLine;                  // first completed line, -1 if none
+    Player winPlayer;             // owner of winLine
+    uint64_t zobrist;             // xor of the keys of all occupied cells
+};
+
+// board type for N x N, K in a row: the bitboard Board for 3x3, BasicBoard otherwise
+template <int N, int K>
+struct BoardSelector {
+    using type = BasicBoard<N, K>;
+};
+
+template <>
+struct BoardSelector<3, 3> {
+    using type = Board;
+};
+
+template <int N, int K>
+using BoardNK = typename BoardSelector<N, K>::type;
+
+#endif // BASIC_BOARD_H
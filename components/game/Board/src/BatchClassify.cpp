@@ -0,0 +1,122 @@
+#include "BatchClassify.h"
+#include "Board.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define BATCH_CLASSIFY_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang compile the kernel for AVX2 without raising the target of the
+// whole library; MSVC accepts the intrinsics as is
+#if defined(BATCH_CLASSIFY_X86) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+namespace {
+
+constexpr uint32_t CELLS_MASK = 0x1FF;
+
+PositionStatus classifyOne(uint32_t packed) {
+    uint32_t x = packed & CELLS_MASK;
+    uint32_t o = (packed >> 9) & CELLS_MASK;
+    bool xWins = false;
+    bool oWins = false;
+    for (uint16_t line : Board::LINE_MASKS) {
+        xWins |= (x & line) == line;
+        oWins |= (o & line) == line;
+    }
+    if (xWins) return PositionStatus::XWins;
+    if (oWins) return PositionStatus::OWins;
+    if ((x | o) == CELLS_MASK) return PositionStatus::Draw;
+    return PositionStatus::Ongoing;
+}
+
+#ifdef BATCH_CLASSIFY_X86
+
+bool cpuHasAvx2() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osSavesYmm = (info[2] & (1 << 27)) && (info[2] & (1 << 28)); // OSXSAVE, AVX
+    if (!osSavesYmm || (_xgetbv(0) & 6) != 6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// 8 positions per iteration: one 32-bit lane per position
+AVX2_TARGET void classifyAvx2(const uint32_t* packed, size_t count, PositionStatus* status) {
+    const __m256i cellsMask = _mm256_set1_epi32(CELLS_MASK);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i three = _mm256_set1_epi32(3);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(packed + i));
+        __m256i x = _mm256_and_si256(v, cellsMask);
+        __m256i o = _mm256_and_si256(_mm256_srli_epi32(v, 9), cellsMask);
+
+        __m256i xWins = _mm256_setzero_si256();
+        __m256i oWins = _mm256_setzero_si256();
+        for (uint16_t mask : Board::LINE_MASKS) {
+            __m256i line = _mm256_set1_epi32(mask);
+            xWins = _mm256_or_si256(xWins, _mm256_cmpeq_epi32(_mm256_and_si256(x, line), line));
+            oWins = _mm256_or_si256(oWins, _mm256_cmpeq_epi32(_mm256_and_si256(o, line), line));
+        }
+        __m256i full = _mm256_cmpeq_epi32(_mm256_or_si256(x, o), cellsMask);
+
+        // X line beats O line beats full board
+        __m256i result = _mm256_and_si256(xWins, one);
+        result = _mm256_or_si256(result, _mm256_andnot_si256(xWins, _mm256_and_si256(oWins, two)));
+        __m256i neither = _mm256_andnot_si256(_mm256_or_si256(xWins, oWins), full);
+        result = _mm256_or_si256(result, _mm256_and_si256(neither, three));
+
+        // narrow the eight 32-bit results to bytes
+        __m256i words = _mm256_packs_epi32(result, result);
+        __m256i bytes = _mm256_packus_epi16(words, words);
+        uint32_t low = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 0));
+        uint32_t high = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 4));
+        std::memcpy(status + i, &low, 4);
+        std::memcpy(status + i + 4, &high, 4);
+    }
+
+    for (; i < count; ++i) status[i] = classifyOne(packed[i]);
+}
+
+#endif // BATCH_CLASSIFY_X86
+
+} // namespace
+
+void classifyPositionsScalar(const uint32_t* packed, size_t count, PositionStatus* status) {
+    for (size_t i = 0; i < count; ++i) status[i] = classifyOne(packed[i]);
+}
+
+bool batchClassifyUsesAvx2() {
+#ifdef BATCH_CLASSIFY_X86
+    static const bool hasAvx2 = cpuHasAvx2();
+    return hasAvx2;
+#else
+    return false;
+#endif
+}
+
+void classifyPositions(const uint32_t* packed, size_t count, PositionStatus* status) {
+#ifdef BATCH_CLASSIFY_X86
+    if (batchClassifyUsesAvx2()) {
+        classifyAvx2(packed, count, status);
+        return;
+    }
+#endif
+    classifyPositionsScalar(packed, count, status);
+}
@@ -0,0 +1,22 @@
+#ifndef BATCH_CLASSIFY_H
+#define BATCH_CLASSIFY_H
+
+#include <cstddef>
+#include <cstdint>
+
+// outcome of a packed 3x3 position (see Board::packed)
+enum class PositionStatus : uint8_t { Ongoing, XWins, OWins, Draw };
+
+// Classify `count` packed positions into status[i]. Uses an AVX2 kernel
+// (8 positions per step) when the CPU supports it, the scalar loop otherwise.
+// A position where both players have a line (unreachable in play) reports
+// XWins; packed bits carry no move order to tell which line came first.
+void classifyPositions(const uint32_t* packed, size_t count, PositionStatus* status);
+
+// portable reference path, always available
+void classifyPositionsScalar(const uint32_t* packed, size_t count, PositionStatus* status);
+
+// true if classifyPositions runs the AVX2 kernel on this machine
+bool batchClassifyUsesAvx2();
+
+#endif // BATCH_CLASSIFY_H
@@ -1,18 +1,98 @@
 #include "Board.h"
+#include "Zobrist.h"
 #include <iostream>
 
+namespace {
+
+// lines passing through each cell, -1 padded (corners 3, edges 2, center 4)
+constexpr int8_t CELL_LINES[9][4] = {
+    {0, 3, 6, -1}, {0, 4, -1, -1}, {0, 5, 7, -1},
+    {1, 3, -1, -1}, {1, 4, 6, 7},  {1, 5, -1, -1},
+    {2, 3, 7, -1}, {2, 4, -1, -1}, {2, 5, 6, -1}
+};
+
+struct ZobristTable {
+    uint64_t keys[2][9]; // [0] X, [1] O per cell
+};
+
+constexpr ZobristTable makeZobristTable() {
+    ZobristTable table{};
+    uint64_t state = ZOBRIST_SEED;
+    for (int side = 0; side < 2; ++side)
+        for (int cell = 0; cell < 9; ++cell)
+            table.keys[side][cell] = splitMix64(state);
+    return table;
+}
+
+constexpr ZobristTable ZOBRIST = makeZobristTable();
+
+} // namespace
+
 // Constructor: start the game all players are none
 Board::Board() {
     reset();
 }
 
+// rebuild a board from packed masks (X cells are played before O cells)
+Board Board::fromPacked(uint32_t packed) {
+    Board board;
+    for (int cell : CellMask<CELLS>(packed & 0x1FFu))
+        board.makeMove(cell, Player::X);
+    for (int cell : CellMask<CELLS>((packed >> 9) & 0x1FFu))
+        board.makeMove(cell, Player::O);
+    return board;
+}
+
 // record move of play if valid
 bool Board::makeMove(int row, int col, Player p) {
-    if (isValidMove(row, col)) {
-        grid[row][col] = p;
-        return true;
+    if (row < 0 || row >= 3 || col < 0 || col >= 3) return false;
+    return makeMove(row * 3 + col, p);
+}
+
+// same, addressed by cell index (what search iterates over)
+bool Board::makeMove(int cell, Player p) {
+    if (cell < 0 || cell >= 9 || p == Player::None) return false;
+    uint16_t bit = static_cast<uint16_t>(1u << cell);
+    if ((xBits | oBits) & bit) return false;
+
+    int side = (p == Player::X) ? 0 : 1;
+    (side == 0 ? xBits : oBits) |= bit;
+    moveStack[movesMade++] = static_cast<uint8_t>(cell);
+    zobrist ^= ZOBRIST.keys[side][cell];
+
+    // only the lines through this cell can have been completed
+    for (int8_t line : CELL_LINES[cell]) {
+        if (line < 0) break;
+        if (++lineCounts[side][line] == 3 && winLine < 0) {
+            winLine = line;
+            winPlayer = p;
+        }
+    }
+    return true;
+}
+
+// take back the last move, so search can explore on one board in place
+bool Board::undoMove() {
+    if (movesMade == 0) return false;
+    int cell = moveStack[--movesMade];
+    uint16_t bit = static_cast<uint16_t>(1u << cell);
+    int side = (xBits & bit) ? 0 : 1;
+    (side == 0 ? xBits : oBits) &= static_cast<uint16_t>(~bit);
+    zobrist ^= ZOBRIST.keys[side][cell];
+
+    for (int8_t line : CELL_LINES[cell]) {
+        if (line < 0) break;
+        --lineCounts[side][line];
+    }
+
+    // moves are taken back in order, so any line completed after winLine is
+    // already gone by the time winLine itself can be broken
+    int winSide = (winPlayer == Player::X) ? 0 : 1;
+    if (winLine >= 0 && lineCounts[winSide][winLine] < 3) {
+        winLine = -1;
+        winPlayer = Player::None;
     }
-    return false;
+    return true;
 }
 
 // check for validation of move (inside board and empty)
@@ -22,73 +102,72 @@ bool Board::isValidMove(int row, int col) const {
 
 // check empty
 bool Board::isCellEmpty(int row, int col) const {
-    return grid[row][col] == Player::None;
+    return ((xBits | oBits) & (1u << (row * 3 + col))) == 0;
 }
 
 // check for full board
 bool Board::isFull() const {
-    for (int i = 0; i < 3; ++i)
-        for (int j = 0; j < 3; ++j)
-            if (grid[i][j] == Player::None)
-                return false;
-    return true;
+    return movesMade == 9;
 }
 
 // reset my board
 void Board::reset() {
-    for (int i = 0; i < 3; ++i)
-        for (int j = 0; j < 3; ++j)
-            grid[i][j] = Player::None;
+    xBits = 0;
+    oBits = 0;
+    for (auto& counts : lineCounts)
+        for (uint8_t& count : counts)
+            count = 0;
+    movesMade = 0;
+    winLine = -1;
+    winPlayer = Player::None;
+    zobrist = 0;
 }
 
 // for printing on console
 void Board::print() const {
     for (int i = 0; i < 3; ++i) {
         for (int j = 0; j < 3; ++j) {
-            std::cout << playerToChar(grid[i][j]) << " ";
+            std::cout << playerToChar(cellAt(i * 3 + j)) << " ";
         }
         std::cout << std::endl;
     }
 }
 
 // decide who won, func return srtuct wininfo
+// (reports the first line completed, tracked by makeMove)
 WinInfo Board::checkWinner() const {
-    // in rows
-    for (int i = 0; i < 3; ++i) {
-        if (grid[i][0] != Player::None &&
-            grid[i][0] == grid[i][1] &&
-            grid[i][1] == grid[i][2]) {
-            return { grid[i][0], "row", i, { {i, 0}, {i, 1}, {i, 2} } };
-        }
-    }
-
-    // in cols
-    for (int i = 0; i < 3; ++i) {
-        if (grid[0][i] != Player::None &&
-            grid[0][i] == grid[1][i] &&
-            grid[1][i] == grid[2][i]) {
-            return { grid[0][i], "col", i, { {0, i}, {1, i}, {2, i} } };
-        }
+    WinInfo info = { Player::None, LineKind::None, -1, 0, {} };
+    if (winLine < 0) {
+        return info;
     }
 
-    // main diag its index -1
-    if (grid[0][0] != Player::None &&
-        grid[0][0] == grid[1][1] &&
-        grid[1][1] == grid[2][2]) {
-        return { grid[0][0], "diag", -1, { {0, 0}, {1, 1}, {2, 2} } };
+    info.winner = winPlayer;
+    if (winLine < 3) {
+        info.type = LineKind::Row;
+        info.index = winLine;
+    } else if (winLine < 6) {
+        info.type = LineKind::Col;
+        info.index = winLine - 3;
+    } else {
+        // diag and anti-diag index -1
+        info.type = (winLine == 6) ? LineKind::Diag : LineKind::AntiDiag;
     }
 
-    // anti-diag its index -1
-    if (grid[0][2] != Player::None &&
-        grid[0][2] == grid[1][1] &&
-        grid[1][1] == grid[2][0]) {
-        return { grid[0][2], "anti-diag", -1, { {0, 2}, {1, 1}, {2, 0} } };
+    uint16_t mask = LINE_MASKS[winLine];
+    for (int cell = 0; cell < 9; ++cell) {
+        if (mask & (1u << cell)) info.winCells[info.cellCount++] = { cell / 3, cell % 3 };
     }
-
-    return { Player::None, "none", -1, {} };
+    return info;
 }
 
 // Game over!
 bool Board::isGameOver() const {
-    return (checkWinner().winner != Player::None || isFull());
+    return (winPlayer != Player::None || movesMade == 9);
+}
+
+// owner of a cell (bit index = row * 3 + col)
+Player Board::cellAt(int cell) const {
+    if (xBits & (1u << cell)) return Player::X;
+    if (oBits & (1u << cell)) return Player::O;
+    return Player::None;
 }
@@ -2,13 +2,30 @@
 #define BOARD_H
 
 #include "globals.h"  // Add this include at the top
+#include "CellMask.h"
+#include <cstdint>
 
 // manage game logic
 class Board {
 public:
+    // shape constants shared with BasicBoard<N, K>, so search code can be
+    // written once for any board size
+    static constexpr int SIZE = 3;       // cells per side
+    static constexpr int WIN_LENGTH = 3; // pieces in a row needed to win
+    static constexpr int CELLS = 9;
+    static constexpr int LINES = 8;
+
+    // the 8 winning lines as cell masks (bit = row * 3 + col):
+    // rows 0..2, cols 0..2, main diag, anti-diag
+    static constexpr uint16_t LINE_MASKS[LINES] = {
+        0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054
+    };
+
     Board();
 
     bool makeMove(int row, int col, Player p);
+    bool makeMove(int cell, Player p); // cell = row * 3 + col
+    bool undoMove(); // take back the last move made
     bool isValidMove(int row, int col) const;
     bool isCellEmpty(int row, int col) const;
     bool isFull() const;
@@ -16,10 +33,38 @@ public:
     void print() const;
 
     WinInfo checkWinner() const;
+    Player winner() const { return winPlayer; } // winner only, for hot paths
     bool isGameOver() const;
+    int moveCount() const { return movesMade; }
+
+    // legal moves: one bit per empty cell
+    CellMask<CELLS> emptyCells() const { return CellMask<CELLS>(~(xBits | oBits) & 0x1FFu); }
+
+    // Zobrist key of the position, kept up to date by makeMove/undoMove/reset
+    uint64_t hash() const { return zobrist; }
+
+    // pieces of player p on line `line` (see LINE_MASKS), for evaluation functions
+    int lineCount(Player p, int line) const { return lineCounts[p == Player::X ? 0 : 1][line]; }
+
+    // both occupancy masks in one word: X in bits 0-8, O in bits 9-17
+    uint32_t packed() const { return xBits | (static_cast<uint32_t>(oBits) << 9); }
+    static Board fromPacked(uint32_t packed);
 
 private:
-    Player grid[3][3]; // 3*3 board
+    Player cellAt(int cell) const;
+
+    // one bit per cell (bit index = row * 3 + col)
+    uint16_t xBits; // cells taken by X
+    uint16_t oBits; // cells taken by O
+
+    // game-over state, updated by makeMove so queries are O(1)
+    uint8_t lineCounts[2][LINES]; // pieces per player ([0] X, [1] O) on each line
+    uint8_t movesMade;        // number of occupied cells
+    uint8_t moveStack[CELLS]; // cells in the order they were played
+    int8_t winLine;           // first completed line, -1 if none
+    Player winPlayer;         // owner of winLine
+
+    uint64_t zobrist;         // xor of the keys of all occupied cells
 };
 
 #endif // BOARD_H
@@ -0,0 +1,89 @@
+#ifndef CELL_MASK_H
+#define CELL_MASK_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// index of the lowest set bit (x must not be 0)
+inline int countTrailingZeros(uint64_t x) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+inline int popCount(uint64_t x) {
+#if defined(_MSC_VER)
+    return static_cast<int>(__popcnt64(x));
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+// Fixed-size set of board cells, one bit per cell. Range-for visits the set
+// cells in increasing order, one count-trailing-zeros per cell:
+//     for (int cell : board.emptyCells()) ...
+template <int Bits>
+class CellMask {
+public:
+    static constexpr int WORDS = (Bits + 63) / 64;
+
+    class iterator {
+    public:
+        iterator(const uint64_t* words, int word) : words(words), word(word), bits(0) {
+            if (word < WORDS) {
+                bits = words[word];
+                skipEmptyWords();
+            }
+        }
+        int operator*() const { return word * 64 + countTrailingZeros(bits); }
+        iterator& operator++() {
+            bits &= bits - 1;  // clear lowest set bit
+            skipEmptyWords();
+            return *this;
+        }
+        bool operator!=(const iterator& other) const { return word != other.word || bits != other.bits; }
+
+    private:
+        void skipEmptyWords() {
+            while (bits == 0 && ++word < WORDS) bits = words[word];
+        }
+
+        const uint64_t* words;
+        int word;
+        uint64_t bits;
+    };
+
+    CellMask() : words{} {}
+    explicit CellMask(uint64_t low) : words{} { words[0] = low; }
+
+    void set(int cell) { words[cell / 64] |= uint64_t(1) << (cell % 64); }
+    void reset(int cell) { words[cell / 64] &= ~(uint64_t(1) << (cell % 64)); }
+    bool test(int cell) const { return (words[cell / 64] >> (cell % 64)) & 1; }
+
+    bool none() const {
+        for (uint64_t w : words)
+            if (w) return false;
+        return true;
+    }
+    int count() const {
+        int total = 0;
+        for (uint64_t w : words) total += popCount(w);
+        return total;
+    }
+    uint64_t word(int i) const { return words[i]; }
+
+    iterator begin() const { return iterator(words, 0); }
+    iterator end() const { return iterator(words, WORDS); }
+
+private:
+    uint64_t words[WORDS];
+};
+
+#endif // CELL_MASK_H
@@ -0,0 +1,15 @@
+#include "PositionIndex.h"
+
+int encodePosition(const Board& board) {
+    return packedToIndex(board.packed());
+}
+
+Board decodePosition(int index) {
+    uint32_t packed = 0;
+    for (int cell = 0; cell < 9; ++cell, index /= 3) {
+        int digit = index % 3;
+        if (digit == 1) packed |= 1u << cell;
+        else if (digit == 2) packed |= 1u << (cell + 9);
+    }
+    return Board::fromPacked(packed);
+}
@@ -0,0 +1,77 @@
+#ifndef POSITION_INDEX_H
+#define POSITION_INDEX_H
+
+#include "Board.h"
+#include <cstdint>
+
+// Perfect index of 3x3 positions: cell (row * 3 + col) is base-3 digit
+// number `cell`, with 0 = empty, 1 = X, 2 = O. Every position maps to a
+// distinct integer in [0, POSITION_COUNT).
+constexpr int POSITION_COUNT = 19683;           // 3^9
+constexpr int REACHABLE_POSITION_COUNT = 5478;  // positions that occur in legal play
+
+namespace position_index_detail {
+
+struct Tables {
+    uint16_t base3[512];   // index of a single player's mask with digit 1
+    uint64_t reachable[(POSITION_COUNT + 63) / 64]; // bit set per reachable index
+};
+
+constexpr Tables makeTables() {
+    Tables t{};
+    int popcount[512] = {};
+    bool hasLine[512] = {};
+    for (int mask = 0; mask < 512; ++mask) {
+        int value = 0;
+        int weight = 1;
+        for (int cell = 0; cell < 9; ++cell, weight *= 3) {
+            if (mask & (1 << cell)) {
+                value += weight;
+                ++popcount[mask];
+            }
+        }
+        t.base3[mask] = static_cast<uint16_t>(value);
+        for (uint16_t line : Board::LINE_MASKS)
+            if ((mask & line) == line)
+                hasLine[mask] = true;
+    }
+
+    // X moves first and nobody moves after a win
+    for (int x = 0; x < 512; ++x) {
+        int free = 0x1FF & ~x;
+        for (int o = free;; o = (o - 1) & free) {
+            int diff = popcount[x] - popcount[o];
+            bool ok = (diff == 0 || diff == 1) &&
+                      !(hasLine[x] && hasLine[o]) &&
+                      !(hasLine[x] && diff != 1) &&
+                      !(hasLine[o] && diff != 0);
+            if (ok) {
+                int index = t.base3[x] + 2 * t.base3[o];
+                t.reachable[index / 64] |= uint64_t(1) << (index % 64);
+            }
+            if (o == 0) break;
+        }
+    }
+    return t;
+}
+
+inline constexpr Tables TABLES = makeTables();
+
+} // namespace position_index_detail
+
+// index of a position given both players' masks (see Board::packed)
+constexpr int packedToIndex(uint32_t packed) {
+    return position_index_detail::TABLES.base3[packed & 0x1FF] +
+           2 * position_index_detail::TABLES.base3[(packed >> 9) & 0x1FF];
+}
+
+// true if the index is a position that can arise in a legal game
+constexpr bool isReachablePosition(int index) {
+    return index >= 0 && index < POSITION_COUNT &&
+           ((position_index_detail::TABLES.reachable[index / 64] >> (index % 64)) & 1) != 0;
+}
+
+int encodePosition(const Board& board);
+Board decodePosition(int index);
+
+#endif // POSITION_INDEX_H
@@ -0,0 +1,166 @@
+#include "RandomPlayouts.h"
+#include "BatchClassify.h"
+#include "Board.h"
+#include "Zobrist.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RANDOM_PLAYOUTS_X86 1
+#include <immintrin.h>
+#endif
+
+// same arrangement as BatchClassify.cpp: only the kernel is built for AVX2
+#if defined(RANDOM_PLAYOUTS_X86) && (defined(__GNUC__) || defined(__clang__))
+#define AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define AVX2_TARGET
+#endif
+
+namespace {
+
+constexpr uint32_t CELLS_MASK = 0x1FF;
+
+bool hasLine(uint32_t mask) {
+    for (uint16_t line : Board::LINE_MASKS)
+        if ((mask & line) == line) return true;
+    return false;
+}
+
+// first xorshift32 state of game `game`, never 0
+uint32_t gameSeed(uint64_t seed, uint64_t game) {
+    uint64_t state = seed + game * 0x9E3779B97F4A7C15ull;
+    return static_cast<uint32_t>(splitMix64(state)) | 1u;
+}
+
+// one game; moves are drawn by rejection: a random cell 0..8, retried
+// until it is empty (the SIMD kernel takes exactly the same steps)
+PositionStatus playOne(uint32_t x, uint32_t o, bool xToMove, uint32_t rng) {
+    for (;;) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        uint32_t bit = 1u << (((rng >> 16) * 9) >> 16);
+        if ((x | o) & bit) continue;
+        if (xToMove) {
+            x |= bit;
+            if (hasLine(x)) return PositionStatus::XWins;
+        } else {
+            o |= bit;
+            if (hasLine(o)) return PositionStatus::OWins;
+        }
+        if ((x | o) == CELLS_MASK) return PositionStatus::Draw;
+        xToMove = !xToMove;
+    }
+}
+
+void count(PlayoutTally& tally, PositionStatus status, uint64_t games) {
+    if (status == PositionStatus::XWins) tally.xWins += games;
+    else if (status == PositionStatus::OWins) tally.oWins += games;
+    else tally.draws += games;
+}
+
+// X line first, as Board reports it
+PositionStatus finishedStatus(uint32_t x, uint32_t o) {
+    if (hasLine(x)) return PositionStatus::XWins;
+    if (hasLine(o)) return PositionStatus::OWins;
+    if ((x | o) == CELLS_MASK) return PositionStatus::Draw;
+    return PositionStatus::Ongoing;
+}
+
+#ifdef RANDOM_PLAYOUTS_X86
+
+// 8 games per batch, one per 32-bit lane; finished lanes keep their board
+// and RNG state while the rest play on
+AVX2_TARGET void playoutsAvx2(uint32_t x0, uint32_t o0, bool xToMove, uint64_t games, uint64_t seed,
+                              PlayoutTally& tally, uint64_t& played) {
+    const __m256i cellsMask = _mm256_set1_epi32(CELLS_MASK);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i nine = _mm256_set1_epi32(9);
+    const __m256i allOnes = _mm256_set1_epi32(-1);
+
+    for (played = 0; played + 8 <= games; played += 8) {
+        alignas(32) uint32_t seeds[8];
+        for (int lane = 0; lane < 8; ++lane) seeds[lane] = gameSeed(seed, played + lane);
+        __m256i rng = _mm256_load_si256(reinterpret_cast<const __m256i*>(seeds));
+        __m256i x = _mm256_set1_epi32(static_cast<int>(x0));
+        __m256i o = _mm256_set1_epi32(static_cast<int>(o0));
+        __m256i turnX = xToMove ? allOnes : _mm256_setzero_si256();
+        __m256i xWon = _mm256_setzero_si256();
+        __m256i oWon = _mm256_setzero_si256();
+        __m256i done = _mm256_setzero_si256();
+
+        while (_mm256_movemask_epi8(done) != -1) {
+            __m256i active = _mm256_xor_si256(done, allOnes);
+            __m256i next = _mm256_xor_si256(rng, _mm256_slli_epi32(rng, 13));
+            next = _mm256_xor_si256(next, _mm256_srli_epi32(next, 17));
+            next = _mm256_xor_si256(next, _mm256_slli_epi32(next, 5));
+            rng = _mm256_blendv_epi8(rng, next, active);
+
+            __m256i cell = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(rng, 16), nine), 16);
+            __m256i bit = _mm256_sllv_epi32(one, cell);
+            __m256i taken = _mm256_and_si256(_mm256_or_si256(x, o), bit);
+            __m256i place = _mm256_and_si256(active, _mm256_cmpeq_epi32(taken, _mm256_setzero_si256()));
+            __m256i placed = _mm256_and_si256(bit, place);
+            x = _mm256_or_si256(x, _mm256_and_si256(placed, turnX));
+            o = _mm256_or_si256(o, _mm256_andnot_si256(turnX, placed));
+
+            __m256i xLine = _mm256_setzero_si256();
+            __m256i oLine = _mm256_setzero_si256();
+            for (uint16_t mask : Board::LINE_MASKS) {
+                __m256i line = _mm256_set1_epi32(mask);
+                xLine = _mm256_or_si256(xLine, _mm256_cmpeq_epi32(_mm256_and_si256(x, line), line));
+                oLine = _mm256_or_si256(oLine, _mm256_cmpeq_epi32(_mm256_and_si256(o, line), line));
+            }
+            xWon = _mm256_or_si256(xWon, _mm256_and_si256(xLine, place));
+            oWon = _mm256_or_si256(oWon, _mm256_and_si256(oLine, place));
+            __m256i full = _mm256_cmpeq_epi32(_mm256_or_si256(x, o), cellsMask);
+            done = _mm256_or_si256(done, _mm256_and_si256(_mm256_or_si256(_mm256_or_si256(xLine, oLine), full), place));
+            turnX = _mm256_xor_si256(turnX, place);
+        }
+
+        int xMask = _mm256_movemask_ps(_mm256_castsi256_ps(xWon));
+        int oMask = _mm256_movemask_ps(_mm256_castsi256_ps(oWon));
+        int xCount = popCount(static_cast<uint64_t>(xMask));
+        int oCount = popCount(static_cast<uint64_t>(oMask));
+        tally.xWins += xCount;
+        tally.oWins += oCount;
+        tally.draws += 8 - xCount - oCount;
+    }
+}
+
+#endif // RANDOM_PLAYOUTS_X86
+
+} // namespace
+
+PlayoutTally randomPlayoutsScalar(uint32_t packed, Player toMove, uint64_t games, uint64_t seed) {
+    PlayoutTally tally;
+    uint32_t x = packed & CELLS_MASK;
+    uint32_t o = (packed >> 9) & CELLS_MASK;
+    PositionStatus status = finishedStatus(x, o);
+    if (status != PositionStatus::Ongoing) {
+        count(tally, status, games);
+        return tally;
+    }
+    for (uint64_t game = 0; game < games; ++game)
+        count(tally, playOne(x, o, toMove == Player::X, gameSeed(seed, game)), 1);
+    return tally;
+}
+
+bool randomPlayoutsUseAvx2() {
+    return batchClassifyUsesAvx2();  // same CPU check
+}
+
+PlayoutTally randomPlayouts(uint32_t packed, Player toMove, uint64_t games, uint64_t seed) {
+#ifdef RANDOM_PLAYOUTS_X86
+    uint32_t x = packed & CELLS_MASK;
+    uint32_t o = (packed >> 9) & CELLS_MASK;
+    if (randomPlayoutsUseAvx2() && finishedStatus(x, o) == PositionStatus::Ongoing) {
+        PlayoutTally tally;
+        uint64_t played = 0;
+        playoutsAvx2(x, o, toMove == Player::X, games, seed, tally, played);
+        for (uint64_t game = played; game < games; ++game)
+            count(tally, playOne(x, o, toMove == Player::X, gameSeed(seed, game)), 1);
+        return tally;
+    }
+#endif
+    return randomPlayoutsScalar(packed, toMove, games, seed);
+}
@@ -0,0 +1,28 @@
+#ifndef RANDOM_PLAYOUTS_H
+#define RANDOM_PLAYOUTS_H
+
+#include "globals.h"
+#include <cstdint>
+
+// results of a batch of random games
+struct PlayoutTally {
+    uint64_t xWins = 0;
+    uint64_t oWins = 0;
+    uint64_t draws = 0;
+};
+
+// Play `games` uniformly random 3x3 games from a packed position (see
+// Board::packed) with toMove to play first, and count the results. Uses
+// an AVX2 kernel (8 games per step, one bitboard per 32-bit lane) when
+// the CPU supports it, the scalar loop otherwise. Game i draws its moves
+// from its own stream derived from seed and i, so both paths return
+// exactly the same tally. A finished position counts as its result.
+PlayoutTally randomPlayouts(uint32_t packed, Player toMove, uint64_t games, uint64_t seed);
+
+// portable reference path, always available
+PlayoutTally randomPlayoutsScalar(uint32_t packed, Player toMove, uint64_t games, uint64_t seed);
+
+// true if randomPlayouts runs the AVX2 kernel on this machine
+bool randomPlayoutsUseAvx2();
+
+#endif // RANDOM_PLAYOUTS_H
@@ -0,0 +1,73 @@
+#include "Symmetry.h"
+
+namespace {
+
+// image of every cell under each transform
+constexpr int8_t CELL_PERMS[SYMMETRY_COUNT][9] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8}, // identity
+    {2, 5, 8, 1, 4, 7, 0, 3, 6}, // rotate 90 cw:  (r, c) -> (c, 2 - r)
+    {8, 7, 6, 5, 4, 3, 2, 1, 0}, // rotate 180:    (r, c) -> (2 - r, 2 - c)
+    {6, 3, 0, 7, 4, 1, 8, 5, 2}, // rotate 270 cw: (r, c) -> (2 - c, r)
+    {2, 1, 0, 5, 4, 3, 8, 7, 6}, // mirror columns: (r, c) -> (r, 2 - c)
+    {6, 7, 8, 3, 4, 5, 0, 1, 2}, // mirror rows:    (r, c) -> (2 - r, c)
+    {0, 3, 6, 1, 4, 7, 2, 5, 8}, // transpose:      (r, c) -> (c, r)
+    {8, 5, 2, 7, 4, 1, 6, 3, 0}  // anti-transpose: (r, c) -> (2 - c, 2 - r)
+};
+
+// rotations by 90 and 270 undo each other, everything else is an involution
+constexpr int8_t INVERSES[SYMMETRY_COUNT] = {0, 3, 2, 1, 4, 5, 6, 7};
+
+// every 9-bit mask permuted by every transform
+struct MaskTables {
+    uint16_t masks[SYMMETRY_COUNT][512];
+
+    MaskTables() {
+        for (int t = 0; t < SYMMETRY_COUNT; ++t) {
+            for (int mask = 0; mask < 512; ++mask) {
+                uint16_t image = 0;
+                for (int cell = 0; cell < 9; ++cell)
+                    if (mask & (1 << cell))
+                        image |= static_cast<uint16_t>(1u << CELL_PERMS[t][cell]);
+                masks[t][mask] = image;
+            }
+        }
+    }
+};
+
+const MaskTables& maskTables() {
+    static const MaskTables tables;
+    return tables;
+}
+
+} // namespace
+
+int transformCell(int cell, int t) {
+    return CELL_PERMS[t][cell];
+}
+
+int inverseTransform(int t) {
+    return INVERSES[t];
+}
+
+uint32_t transformPacked(uint32_t packed, int t) {
+    const MaskTables& tables = maskTables();
+    return tables.masks[t][packed & 0x1FF] |
+           (static_cast<uint32_t>(tables.masks[t][(packed >> 9) & 0x1FF]) << 9);
+}
+
+CanonicalPosition canonicalize(const Board& board) {
+    uint32_t packed = board.packed();
+    CanonicalPosition best = { packed, 0 };
+    for (int t = 1; t < SYMMETRY_COUNT; ++t) {
+        uint32_t image = transformPacked(packed, t);
+        if (image < best.packed) {
+            best = { image, t };
+        }
+    }
+    return best;
+}
+
+std::pair<int, int> toOriginalMove(std::pair<int, int> canonicalMove, int transform) {
+    int cell = transformCell(canonicalMove.first * 3 + canonicalMove.second, inverseTransform(transform));
+    return { cell / 3, cell % 3 };
+}
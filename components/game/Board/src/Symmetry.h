@@ -0,0 +1,35 @@
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include "Board.h"
+#include <cstdint>
+#include <utility>
+
+// The 8 rotations and reflections of the 3x3 board (dihedral group D4).
+// Transform 0 is the identity:
+//   0 identity        1 rotate 90 cw    2 rotate 180      3 rotate 270 cw
+//   4 mirror columns  5 mirror rows     6 transpose       7 anti-transpose
+constexpr int SYMMETRY_COUNT = 8;
+
+// canonical representative of a position's symmetry class
+struct CanonicalPosition {
+    uint32_t packed; // smallest packed form (see Board::packed) over all 8 transforms
+    int transform;   // transform that maps the original position onto packed
+};
+
+// cell (row * 3 + col) that `cell` lands on under transform t
+int transformCell(int cell, int t);
+
+// transform that undoes t
+int inverseTransform(int t);
+
+// apply transform t to a packed position (table lookup per player mask)
+uint32_t transformPacked(uint32_t packed, int t);
+
+// canonical form of a position and the transform that produces it
+CanonicalPosition canonicalize(const Board& board);
+
+// map a move chosen on the canonical board back to the original board
+std::pair<int, int> toOriginalMove(std::pair<int, int> canonicalMove, int transform);
+
+#endif // SYMMETRY_H
@@ -0,0 +1,17 @@
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <cstdint>
+
+// fixed seed so Zobrist keys are the same in every run and on every board size
+constexpr uint64_t ZOBRIST_SEED = 0x5443544F45ull;
+
+// splitmix64 step, used to fill Zobrist tables at compile time
+constexpr uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+#endif // ZOBRIST_H
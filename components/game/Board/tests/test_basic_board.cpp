@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include <type_traits>
+#include "Board.h"
+#include "BasicBoard.h"
+
+// Group 1: board selection
+TEST(BasicBoardTest, ThreeByThreeSelectsBitboard) {
+    EXPECT_TRUE((std::is_same<BoardNK<3, 3>, Board>::value));
+    EXPECT_TRUE((std::is_same<BoardNK<4, 3>, BasicBoard<4, 3>>::value));
+}
+
+TEST(BasicBoardTest, LineCounts) {
+    EXPECT_EQ((BasicBoard<3, 3>::LINES), 8);
+    EXPECT_EQ((BasicBoard<4, 4>::LINES), 10);
+    EXPECT_EQ((BasicBoard<15, 5>::LINES), 572);
+}
+
+// Group 2: basic moves
+TEST(BasicBoardTest, MovesAndBounds) {
+    BasicBoard<4, 3> board;
+    EXPECT_TRUE(board.isValidMove(3, 3));
+    EXPECT_FALSE(board.isValidMove(4, 0));
+    EXPECT_TRUE(board.makeMove(3, 3, Player::X));
+    EXPECT_FALSE(board.makeMove(3, 3, Player::O));
+    EXPECT_EQ(board.cellAt(3, 3), Player::X);
+    EXPECT_EQ(board.moveCount(), 1);
+}
+
+// Group 3: k in a row in every direction
+TEST(BasicBoardTest, RowWinNeedsK) {
+    BasicBoard<5, 4> board;
+    for (int c = 0; c < 3; ++c) board.makeMove(2, c, Player::O);
+    EXPECT_FALSE(board.isGameOver());
+    board.makeMove(2, 3, Player::O);
+    EXPECT_EQ(board.winner(), Player::O);
+}
+
+TEST(BasicBoardTest, ColumnWin) {
+    BasicBoard<5, 4> board;
+    for (int r = 1; r < 5; ++r) board.makeMove(r, 4, Player::X);
+    EXPECT_EQ(board.winner(), Player::X);
+    auto cells = board.winningCells();
+    EXPECT_EQ(cells[0].row, 1);
+    EXPECT_EQ(cells[3].row, 4);
+    EXPECT_EQ(cells[3].col, 4);
+}
+
+TEST(BasicBoardTest, DiagonalWins) {
+    BasicBoard<6, 5> diag;
+    for (int i = 0; i < 5; ++i) diag.makeMove(i + 1, i, Player::X);
+    EXPECT_EQ(diag.winner(), Player::X);
+
+    BasicBoard<6, 5> anti;
+    for (int i = 0; i < 5; ++i) anti.makeMove(i, 5 - i, Player::O);
+    EXPECT_EQ(anti.winner(), Player::O);
+}
+
+TEST(BasicBoardTest, UndoRestoresState) {
+    BasicBoard<4, 4> board;
+    for (int c = 0; c < 3; ++c) board.makeMove(0, c, Player::X);
+    uint64_t before = board.hash();
+    board.makeMove(0, 3, Player::X);
+    EXPECT_TRUE(board.isGameOver());
+    EXPECT_TRUE(board.undoMove());
+    EXPECT_FALSE(board.isGameOver());
+    EXPECT_EQ(board.hash(), before);
+}
+
+TEST(BasicBoardTest, FifteenByFifteenFiveInARow) {
+    BasicBoard<15, 5> board;
+    for (int i = 0; i < 4; ++i) board.makeMove(10 + i, 14 - i, Player::X);
+    EXPECT_FALSE(board.isGameOver());
+    board.makeMove(14, 10, Player::X);
+    EXPECT_EQ(board.winner(), Player::X);
+}
+
+// Group 4: BasicBoard<3, 3> behaves like Board
+TEST(BasicBoardTest, MatchesBitboardOnRandomGames) {
+    std::mt19937 rng(1234);
+    for (int game = 0; game < 200; ++game) {
+        Board fast;
+        BasicBoard<3, 3> generic;
+        Player p = Player::X;
+        while (!fast.isGameOver()) {
+            int cell = std::uniform_int_distribution<int>(0, 8)(rng);
+            bool ok = fast.makeMove(cell / 3, cell % 3, p);
+            ASSERT_EQ(generic.makeMove(cell / 3, cell % 3, p), ok);
+            if (ok) p = (p == Player::X) ? Player::O : Player::X;
+            ASSERT_EQ(fast.winner(), generic.winner());
+            ASSERT_EQ(fast.isGameOver(), generic.isGameOver());
+            ASSERT_EQ(fast.hash(), generic.hash());
+        }
+    }
+}
+
+// Group 5: empty-cell mask across several words
+TEST(BasicBoardTest, EmptyCellsSpansWords) {
+    BasicBoard<15, 5> board;
+    EXPECT_EQ(board.emptyCells().count(), 225);
+    for (int cell = 0; cell < 225; ++cell)
+        if (cell != 63 && cell != 64 && cell != 200)
+            board.makeMove(cell, cell % 2 ? Player::O : Player::X);
+    std::vector<int> cells;
+    for (int cell : board.emptyCells()) cells.push_back(cell);
+    EXPECT_EQ(cells, (std::vector<int>{63, 64, 200}));
+}
+
+TEST(BasicBoardTest, EmptyMaskIteratesNothing) {
+    CellMask<130> mask;
+    EXPECT_TRUE(mask.none());
+    EXPECT_FALSE(mask.begin() != mask.end());
+    mask.set(129);
+    EXPECT_EQ(*mask.begin(), 129);
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <vector>
+#include "Board.h"
+#include "BatchClassify.h"
+#include "PositionIndex.h"
+
+namespace {
+
+PositionStatus statusFromBoard(const Board& board) {
+    if (board.winner() == Player::X) return PositionStatus::XWins;
+    if (board.winner() == Player::O) return PositionStatus::OWins;
+    if (board.isFull()) return PositionStatus::Draw;
+    return PositionStatus::Ongoing;
+}
+
+} // namespace
+
+// Group 1: every position agrees with Board
+TEST(BatchClassifyTest, MatchesBoardOnEveryPosition) {
+    std::vector<uint32_t> packed;
+    std::vector<PositionStatus> expected;
+    for (int index = 0; index < POSITION_COUNT; ++index) {
+        Board board = decodePosition(index);
+        packed.push_back(board.packed());
+        expected.push_back(statusFromBoard(board));
+    }
+
+    std::vector<PositionStatus> scalar(packed.size());
+    classifyPositionsScalar(packed.data(), packed.size(), scalar.data());
+    std::vector<PositionStatus> fast(packed.size());
+    classifyPositions(packed.data(), packed.size(), fast.data());
+
+    for (size_t i = 0; i < packed.size(); ++i) {
+        ASSERT_EQ(scalar[i], expected[i]) << "index " << i;
+        ASSERT_EQ(fast[i], expected[i]) << "index " << i;
+    }
+}
+
+// Group 2: batch sizes that are not a multiple of the vector width
+TEST(BatchClassifyTest, HandlesShortAndRaggedBatches) {
+    Board xRow;
+    xRow.makeMove(0, 0, Player::X);
+    xRow.makeMove(0, 1, Player::X);
+    xRow.makeMove(0, 2, Player::X);
+    std::vector<uint32_t> packed(13, 0);
+    packed[12] = xRow.packed();
+    packed[3] = xRow.packed();
+
+    std::vector<PositionStatus> status(13, PositionStatus::Draw);
+    classifyPositions(packed.data(), packed.size(), status.data());
+    for (size_t i = 0; i < packed.size(); ++i) {
+        EXPECT_EQ(status[i], (i == 3 || i == 12) ? PositionStatus::XWins : PositionStatus::Ongoing);
+    }
+
+    classifyPositions(packed.data(), 0, status.data());  // no-op
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <vector>
 #include "Board.h"
 
 // Group 1: isCellEmpty
@@ -76,9 +77,9 @@ TEST(BoardTest, CheckWinnerRow) {
     board.makeMove(1, 2, Player::O);
     WinInfo win = board.checkWinner();
     EXPECT_EQ(win.winner, Player::O);
-    EXPECT_EQ(win.type, "row");
+    EXPECT_EQ(win.type, LineKind::Row);
     EXPECT_EQ(win.index, 1);
-    EXPECT_EQ(win.winCells.size(), 3);
+    EXPECT_EQ(win.cellCount, 3);
 }
 
 // Group 7: checkWinner - columns
@@ -89,7 +90,7 @@ TEST(BoardTest, CheckWinnerColumn) {
     board.makeMove(2, 2, Player::X);
     WinInfo win = board.checkWinner();
     EXPECT_EQ(win.winner, Player::X);
-    EXPECT_EQ(win.type, "col");
+    EXPECT_EQ(win.type, LineKind::Col);
     EXPECT_EQ(win.index, 2);
 }
 
@@ -101,7 +102,7 @@ TEST(BoardTest, CheckWinnerMainDiagonal) {
     board.makeMove(2, 2, Player::X);
     WinInfo win = board.checkWinner();
     EXPECT_EQ(win.winner, Player::X);
-    EXPECT_EQ(win.type, "diag");
+    EXPECT_EQ(win.type, LineKind::Diag);
 }
 
 // Group 9: checkWinner - anti diagonal
@@ -112,7 +113,7 @@ TEST(BoardTest, CheckWinnerAntiDiagonal) {
     board.makeMove(2, 0, Player::O);
     WinInfo win = board.checkWinner();
     EXPECT_EQ(win.winner, Player::O);
-    EXPECT_EQ(win.type, "anti-diag");
+    EXPECT_EQ(win.type, LineKind::AntiDiag);
 }
 
 // Group 10: checkWinner - no winner
@@ -123,8 +124,8 @@ TEST(BoardTest, NoWinner) {
     board.makeMove(0, 2, Player::X);
     WinInfo win = board.checkWinner();
     EXPECT_EQ(win.winner, Player::None);
-    EXPECT_EQ(win.type, "none");
-    EXPECT_EQ(win.winCells.empty(), true);
+    EXPECT_EQ(win.type, LineKind::None);
+    EXPECT_EQ(win.cellCount, 0);
 }
 
 // Group 11: isGameOver
@@ -154,3 +155,170 @@ TEST(BoardTest, GameIsNotOverInitially) {
     Board board;
     EXPECT_FALSE(board.isGameOver());
 }
+
+// Group 12: bitboard line masks report the right cells
+TEST(BoardTest, CheckWinnerReportsWinningCells) {
+    Board board;
+    board.makeMove(0, 2, Player::X);
+    board.makeMove(1, 1, Player::X);
+    board.makeMove(2, 0, Player::X);
+    WinInfo win = board.checkWinner();
+    int expected[3][2] = { {0, 2}, {1, 1}, {2, 0} };
+    ASSERT_EQ(win.cellCount, 3);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(win.winCells[i].row, expected[i][0]);
+        EXPECT_EQ(win.winCells[i].col, expected[i][1]);
+    }
+}
+
+TEST(BoardTest, MixedLineIsNotAWin) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(2, 2, Player::X);
+    EXPECT_EQ(board.checkWinner().winner, Player::None);
+    EXPECT_FALSE(board.isGameOver());
+}
+
+// Group 13: incremental game-over tracking
+TEST(BoardTest, MoveCompletingTwoLinesReportsRowFirst) {
+    Board board;
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(0, 2, Player::X);
+    board.makeMove(1, 0, Player::X);
+    board.makeMove(2, 0, Player::X);
+    EXPECT_FALSE(board.isGameOver());
+    board.makeMove(0, 0, Player::X); // completes row 0 and col 0
+    WinInfo win = board.checkWinner();
+    EXPECT_EQ(win.type, LineKind::Row);
+    EXPECT_EQ(win.index, 0);
+}
+
+TEST(BoardTest, ResetClearsGameOverState) {
+    Board board;
+    board.makeMove(0, 0, Player::O);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(2, 2, Player::O);
+    EXPECT_TRUE(board.isGameOver());
+    board.reset();
+    EXPECT_FALSE(board.isGameOver());
+    EXPECT_EQ(board.checkWinner().winner, Player::None);
+}
+
+// Group 14: undoMove
+TEST(BoardTest, UndoOnEmptyBoardReturnsFalse) {
+    Board board;
+    EXPECT_FALSE(board.undoMove());
+}
+
+TEST(BoardTest, UndoRestoresCellAndGameOverState) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(0, 2, Player::X);
+    EXPECT_TRUE(board.isGameOver());
+    EXPECT_TRUE(board.undoMove());
+    EXPECT_TRUE(board.isCellEmpty(0, 2));
+    EXPECT_FALSE(board.isGameOver());
+    EXPECT_EQ(board.checkWinner().winner, Player::None);
+}
+
+TEST(BoardTest, UndoAfterWinKeepsWinner) {
+    Board board;
+    board.makeMove(0, 0, Player::O);
+    board.makeMove(0, 1, Player::O);
+    board.makeMove(0, 2, Player::O); // row 0
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(2, 2, Player::O); // diag, played after the win
+    board.undoMove();
+    WinInfo win = board.checkWinner();
+    EXPECT_EQ(win.winner, Player::O);
+    EXPECT_EQ(win.type, LineKind::Row);
+}
+
+// Group 15: Zobrist hash
+TEST(BoardTest, HashIsZeroForEmptyBoard) {
+    Board board;
+    EXPECT_EQ(board.hash(), 0u);
+    board.makeMove(1, 1, Player::X);
+    EXPECT_NE(board.hash(), 0u);
+    board.reset();
+    EXPECT_EQ(board.hash(), 0u);
+}
+
+TEST(BoardTest, HashDependsOnPositionNotMoveOrder) {
+    Board a, b;
+    a.makeMove(0, 0, Player::X);
+    a.makeMove(2, 2, Player::O);
+    a.makeMove(0, 1, Player::X);
+    b.makeMove(0, 1, Player::X);
+    b.makeMove(2, 2, Player::O);
+    b.makeMove(0, 0, Player::X);
+    EXPECT_EQ(a.hash(), b.hash());
+
+    Board c;
+    c.makeMove(0, 0, Player::O);
+    c.makeMove(2, 2, Player::X);
+    c.makeMove(0, 1, Player::O);
+    EXPECT_NE(a.hash(), c.hash());
+}
+
+TEST(BoardTest, UndoRestoresHash) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    uint64_t before = board.hash();
+    board.makeMove(1, 2, Player::O);
+    board.undoMove();
+    EXPECT_EQ(board.hash(), before);
+}
+
+// Group 16: winner-only query and line names
+TEST(BoardTest, WinnerMatchesCheckWinner) {
+    Board board;
+    EXPECT_EQ(board.winner(), Player::None);
+    board.makeMove(0, 1, Player::O);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(2, 1, Player::O);
+    EXPECT_EQ(board.winner(), Player::O);
+    EXPECT_EQ(board.winner(), board.checkWinner().winner);
+}
+
+TEST(BoardTest, LineKindNames) {
+    EXPECT_STREQ(lineKindToString(LineKind::Row), "row");
+    EXPECT_STREQ(lineKindToString(LineKind::AntiDiag), "anti-diag");
+    EXPECT_STREQ(lineKindToString(LineKind::None), "none");
+}
+
+// Group 17: empty-cell mask
+TEST(BoardTest, EmptyCellsListsFreeCellsInOrder) {
+    Board board;
+    EXPECT_EQ(board.emptyCells().count(), 9);
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    std::vector<int> cells;
+    for (int cell : board.emptyCells()) cells.push_back(cell);
+    EXPECT_EQ(cells, (std::vector<int>{1, 2, 3, 5, 6, 7, 8}));
+}
+
+TEST(BoardTest, MakeMoveByCellIndex) {
+    Board board;
+    EXPECT_TRUE(board.makeMove(5, Player::O));
+    EXPECT_FALSE(board.isCellEmpty(1, 2));
+    EXPECT_FALSE(board.makeMove(5, Player::X));
+    EXPECT_FALSE(board.makeMove(9, Player::X));
+    EXPECT_FALSE(board.makeMove(-1, Player::X));
+}
+
+// Group 18: per-line piece counts
+TEST(BoardTest, LineCountTracksMoves) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(0, 2, Player::X);
+    EXPECT_EQ(board.lineCount(Player::X, 0), 2);  // top row
+    EXPECT_EQ(board.lineCount(Player::O, 0), 0);
+    EXPECT_EQ(board.lineCount(Player::O, 6), 1);  // main diagonal
+    EXPECT_EQ(board.lineCount(Player::X, 6), 1);
+    board.undoMove();
+    EXPECT_EQ(board.lineCount(Player::X, 0), 1);
+}
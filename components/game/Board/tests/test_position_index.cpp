@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "Board.h"
+#include "PositionIndex.h"
+
+// Group 1: encode
+TEST(PositionIndexTest, EmptyBoardIsZero) {
+    Board board;
+    EXPECT_EQ(encodePosition(board), 0);
+}
+
+TEST(PositionIndexTest, DigitsFollowCellOrder) {
+    Board board;
+    board.makeMove(0, 1, Player::X);  // digit 1 -> 1 * 3
+    board.makeMove(2, 2, Player::O);  // digit 8 -> 2 * 6561
+    EXPECT_EQ(encodePosition(board), 3 + 2 * 6561);
+}
+
+TEST(PositionIndexTest, FullOBoardIsLastIndex) {
+    Board board;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            board.makeMove(i, j, Player::O);
+    EXPECT_EQ(encodePosition(board), POSITION_COUNT - 1);
+}
+
+// Group 2: decode is the inverse of encode
+TEST(PositionIndexTest, RoundTripsEveryIndex) {
+    for (int index = 0; index < POSITION_COUNT; ++index)
+        ASSERT_EQ(encodePosition(decodePosition(index)), index);
+}
+
+TEST(PositionIndexTest, DecodeRestoresWinner) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(1, 1, Player::X);
+    board.makeMove(2, 0, Player::O);
+    board.makeMove(2, 2, Player::X);
+    Board decoded = decodePosition(encodePosition(board));
+    EXPECT_EQ(decoded.winner(), Player::X);
+    EXPECT_EQ(decoded.hash(), board.hash());
+}
+
+// Group 3: reachable table
+TEST(PositionIndexTest, CountsReachablePositions) {
+    int count = 0;
+    for (int index = 0; index < POSITION_COUNT; ++index)
+        if (isReachablePosition(index)) ++count;
+    EXPECT_EQ(count, REACHABLE_POSITION_COUNT);
+}
+
+TEST(PositionIndexTest, ReachabilityIsKnownAtCompileTime) {
+    static_assert(isReachablePosition(0), "empty board is reachable");
+    static_assert(!isReachablePosition(2), "O cannot move first");
+    static_assert(!isReachablePosition(-1), "out of range");
+    SUCCEED();
+}
+
+TEST(PositionIndexTest, NoMovesAfterAWin) {
+    // X X X / O O _ / O _ _ : O moved after X already won
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(0, 2, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(2, 0, Player::O);
+    EXPECT_FALSE(isReachablePosition(encodePosition(board)));
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "Board.h"
+#include "PositionIndex.h"
+#include "RandomPlayouts.h"
+
+namespace {
+
+uint64_t total(const PlayoutTally& tally) {
+    return tally.xWins + tally.oWins + tally.draws;
+}
+
+} // namespace
+
+// Group 1: the SIMD kernel and the scalar loop play exactly the same games
+TEST(RandomPlayoutsTest, KernelMatchesScalar) {
+    for (int index = 0; index < POSITION_COUNT; index += 97) {
+        if (!isReachablePosition(index)) continue;
+        Board board = decodePosition(index);
+        Player p = (board.moveCount() % 2 == 0) ? Player::X : Player::O;
+        for (uint64_t games : {1ull, 7ull, 8ull, 61ull, 1000ull}) {
+            PlayoutTally fast = randomPlayouts(board.packed(), p, games, index);
+            PlayoutTally scalar = randomPlayoutsScalar(board.packed(), p, games, index);
+            ASSERT_EQ(fast.xWins, scalar.xWins) << "index " << index;
+            ASSERT_EQ(fast.oWins, scalar.oWins) << "index " << index;
+            ASSERT_EQ(fast.draws, scalar.draws) << "index " << index;
+            ASSERT_EQ(total(fast), games);
+        }
+    }
+}
+
+// Group 2: random play from the empty board has the known odds
+// (X wins 58.5%, O 28.8%, draws 12.7%)
+TEST(RandomPlayoutsTest, EmptyBoardOdds) {
+    const uint64_t games = 400000;
+    PlayoutTally tally = randomPlayouts(0, Player::X, games, 12345);
+    EXPECT_NEAR(double(tally.xWins) / games, 0.585, 0.01);
+    EXPECT_NEAR(double(tally.oWins) / games, 0.288, 0.01);
+    EXPECT_NEAR(double(tally.draws) / games, 0.127, 0.01);
+}
+
+// Group 3: forced and finished positions
+TEST(RandomPlayoutsTest, ForcedAndFinishedPositions) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(0, 1, Player::X);
+    board.makeMove(0, 2, Player::O);
+    board.makeMove(2, 0, Player::X);
+    board.makeMove(1, 0, Player::O);
+    board.makeMove(1, 2, Player::X);
+    board.makeMove(2, 2, Player::O);
+    // X X O
+    // O O X
+    // X _ O   one cell left: X's last move draws
+    PlayoutTally last = randomPlayouts(board.packed(), Player::X, 100, 1);
+    EXPECT_EQ(last.draws, 100u);
+
+    board.makeMove(2, 1, Player::X);
+    PlayoutTally full = randomPlayouts(board.packed(), Player::O, 50, 1);
+    EXPECT_EQ(full.draws, 50u);
+
+    Board won;
+    won.makeMove(0, 0, Player::O);
+    won.makeMove(1, 1, Player::O);
+    won.makeMove(2, 2, Player::O);
+    EXPECT_EQ(randomPlayouts(won.packed(), Player::X, 20, 1).oWins, 20u);
+}
+
+// Group 4: the seed picks the games
+TEST(RandomPlayoutsTest, SeedIsReproducible) {
+    Board board;
+    board.makeMove(1, 1, Player::X);
+    PlayoutTally a = randomPlayouts(board.packed(), Player::O, 999, 42);
+    PlayoutTally b = randomPlayouts(board.packed(), Player::O, 999, 42);
+    EXPECT_EQ(a.xWins, b.xWins);
+    EXPECT_EQ(a.oWins, b.oWins);
+    PlayoutTally c = randomPlayouts(board.packed(), Player::O, 999, 43);
+    EXPECT_EQ(total(c), 999u);
+}
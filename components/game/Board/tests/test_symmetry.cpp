@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include <set>
+#include "Board.h"
+#include "Symmetry.h"
+
+// Group 1: transforms are permutations with correct inverses
+TEST(SymmetryTest, EachTransformIsAPermutation) {
+    for (int t = 0; t < SYMMETRY_COUNT; ++t) {
+        std::set<int> images;
+        for (int cell = 0; cell < 9; ++cell)
+            images.insert(transformCell(cell, t));
+        EXPECT_EQ(images.size(), 9u);
+        EXPECT_EQ(transformCell(4, t), 4);  // center never moves
+    }
+}
+
+TEST(SymmetryTest, InverseUndoesTransform) {
+    for (int t = 0; t < SYMMETRY_COUNT; ++t)
+        for (int cell = 0; cell < 9; ++cell)
+            EXPECT_EQ(transformCell(transformCell(cell, t), inverseTransform(t)), cell);
+}
+
+TEST(SymmetryTest, RotateNinetyMovesTopLeftToTopRight) {
+    EXPECT_EQ(transformCell(0, 1), 2);
+}
+
+// Group 2: packed transforms
+TEST(SymmetryTest, TransformPackedMovesBothPlayers) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(0, 1, Player::O);
+    Board rotated = Board::fromPacked(transformPacked(board.packed(), 1));
+    EXPECT_FALSE(rotated.isCellEmpty(0, 2));  // X
+    EXPECT_FALSE(rotated.isCellEmpty(1, 2));  // O
+    EXPECT_EQ(rotated.packed(), (1u << 2) | (1u << (5 + 9)));
+}
+
+// Group 3: canonicalize
+TEST(SymmetryTest, EquivalentPositionsShareCanonicalForm) {
+    Board corners[4];
+    corners[0].makeMove(0, 0, Player::X);
+    corners[1].makeMove(0, 2, Player::X);
+    corners[2].makeMove(2, 0, Player::X);
+    corners[3].makeMove(2, 2, Player::X);
+    uint32_t canonical = canonicalize(corners[0]).packed;
+    for (const Board& board : corners)
+        EXPECT_EQ(canonicalize(board).packed, canonical);
+}
+
+TEST(SymmetryTest, CanonicalTransformProducesCanonicalForm) {
+    Board board;
+    board.makeMove(2, 1, Player::X);
+    board.makeMove(0, 2, Player::O);
+    CanonicalPosition canon = canonicalize(board);
+    EXPECT_EQ(transformPacked(board.packed(), canon.transform), canon.packed);
+}
+
+TEST(SymmetryTest, MoveMapsBackToOriginalBoard) {
+    Board board;
+    board.makeMove(2, 2, Player::X);
+    CanonicalPosition canon = canonicalize(board);
+    // the X sits on the canonical board where the original X moved to
+    int canonicalCell = transformCell(8, canon.transform);
+    auto original = toOriginalMove({canonicalCell / 3, canonicalCell % 3}, canon.transform);
+    EXPECT_EQ(original, std::make_pair(2, 2));
+}
+
+TEST(SymmetryTest, FromPackedRoundTrips) {
+    Board board;
+    board.makeMove(0, 0, Player::X);
+    board.makeMove(1, 1, Player::O);
+    board.makeMove(2, 0, Player::X);
+    Board copy = Board::fromPacked(board.packed());
+    EXPECT_EQ(copy.packed(), board.packed());
+    EXPECT_EQ(copy.hash(), board.hash());
+}
@@ -7,3 +7,13 @@ char playerToChar(Player p) {
         default:        return '-';
     }
 }
+
+const char* lineKindToString(LineKind kind) {
+    switch (kind) {
+        case LineKind::Row:      return "row";
+        case LineKind::Col:      return "col";
+        case LineKind::Diag:     return "diag";
+        case LineKind::AntiDiag: return "anti-diag";
+        default:                 return "none";
+    }
+}
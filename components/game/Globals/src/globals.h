@@ -1,20 +1,33 @@
 #ifndef GLOBALS_H
 #define GLOBALS_H
 
-#include <string>
-#include <vector>
-#include <utility>  //for using pair
+#include <array>
+#include <type_traits>
 
 // modes of play
 enum class Player { None, X, O };
 
+// kinds of winning line
+enum class LineKind { None, Row, Col, Diag, AntiDiag };
+
 // convert play to char for printing
 char playerToChar(Player p);
-// Struct for details of winning
+// convert line kind to its name: "row", "col", "diag", "anti-diag", "none"
+const char* lineKindToString(LineKind kind);
+
+// a board cell
+struct CellPos {
+    int row;
+    int col;
+};
+
+// Struct for details of winning (plain data, no heap allocation)
 struct WinInfo {
-    Player winner;                           // player who win
-    std::string type;                        // "row", "col", "diag", "anti-diag", "none"
-    int index;                               // no of row,col and diag
-    std::vector<std::pair<int, int>> winCells; // places of winning
+    Player winner;                 // player who win
+    LineKind type;                 // kind of winning line, None if no winner
+    int index;                     // no of row,col (-1 for diagonals and none)
+    int cellCount;                 // used entries of winCells (0 or 3)
+    std::array<CellPos, 3> winCells; // places of winning
 };
+static_assert(std::is_trivially_copyable<WinInfo>::value, "WinInfo must stay plain data");
 #endif 
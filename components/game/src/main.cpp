@@ -1,5 +1,6 @@
 #include "Board.h"
 #include "AI.h"
+#include "Engine.h"
 #include <iostream>
 #include <string>
 #include <limits>
@@ -57,6 +58,27 @@ int main() {
         }
     }
 
+    // Get the AI engine for this game
+    SearchOptions aiOptions;
+    Mcts<Board> mctsEngine; // reused for every AI move of the game
+    aiOptions.mcts = &mctsEngine;
+    while (true) {
+        std::cout << "Play against perfect minimax or Monte Carlo tree search? (m/c): ";
+        std::cin >> playerChoice;
+        playerChoice = std::tolower(playerChoice);
+
+        if (playerChoice == 'm') {
+            aiOptions.engine = Engine::Minimax;
+            break;
+        } else if (playerChoice == 'c') {
+            aiOptions.engine = Engine::Mcts;
+            break;
+        } else {
+            std::cout << "Invalid choice! Please enter 'm' or 'c'.\n";
+            clearInputBuffer();
+        }
+    }
+
     // Game loop
     Player currentPlayer = Player::X;  // X always goes first
     std::cout << "\nGame starting! Use row (0-2) and column (0-2) to make your move.\n\n";
@@ -76,7 +98,7 @@ int main() {
         } else {
             // AI's turn
             std::cout << "AI's turn (Player " << playerToChar(aiPlayer) << ")...\n";
-            move = findBestMove(board, aiPlayer);
+            move = searchBestMove(board, aiPlayer, aiOptions).move;
         }
         
         board.makeMove(move.first, move.second, currentPlayer);
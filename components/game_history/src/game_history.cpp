@@ -1,4 +1,5 @@
 #include "game_history.h"
+#include "PositionIndex.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -93,6 +94,21 @@ std::string GameHistory::serializeMoves(const std::vector<Move>& moves) {
     return ss.str();
 }
 
+std::vector<int> GameHistory::positionSnapshots(const std::vector<Move>& moves) {
+    std::vector<int> snapshots;
+    snapshots.reserve(moves.size());
+    Board board;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        Player player = (i % 2 == 0) ? Player::X : Player::O; // X on even moves, O on odd
+        // makeMove rejects cells outside 0-8 and cells already taken
+        if (!board.makeMove(moves[i].position, player)) {
+            break;
+        }
+        snapshots.push_back(encodePosition(board));
+    }
+    return snapshots;
+}
+
 std::vector<GameHistory::Move> GameHistory::deserializeMoves(const std::string& serialized_moves) {
     std::vector<Move> moves;
     if (serialized_moves.empty()) {
@@ -70,6 +70,11 @@ public:
     // Retrieve latest games (limit specifies how many)
     std::vector<GameRecord> getLatestGames(int limit);
 
+    // Board snapshot after each move as a base-3 position index (X moves first;
+    // encodePosition from the board library). Stops at the first move outside
+    // 0-8 or onto a cell already taken.
+    static std::vector<int> positionSnapshots(const std::vector<Move>& moves);
+
 signals:
     // Signals emitted when game events occur
     void gameInitialized(int gameId);
@@ -336,7 +336,28 @@ TEST_F(GameHistoryTest, UsernameGameIntegration) {
     EXPECT_EQ(game.winner_id.value(), alice_id);
 }
 
+// Test compact board snapshots built from a game's moves
+TEST_F(GameHistoryTest, PositionSnapshots) {
+    int game_id = history->initializeGame(1, 2);
+    history->recordMove(game_id, 4); // X center
+    history->recordMove(game_id, 0); // O top-left
+    history->recordMove(game_id, 8); // X bottom-right
+
+    auto game = history->getGameById(game_id);
+    std::vector<int> snapshots = GameHistory::positionSnapshots(game.moves);
+    ASSERT_EQ(snapshots.size(), 3);
+    EXPECT_EQ(snapshots[0], 81);               // 1 * 3^4
+    EXPECT_EQ(snapshots[1], 81 + 2);           // + 2 * 3^0
+    EXPECT_EQ(snapshots[2], 81 + 2 + 6561);    // + 1 * 3^8
+
+    // invalid positions end the replay
+    std::vector<GameHistory::Move> bad = { {4}, {9}, {0} };
+    EXPECT_EQ(GameHistory::positionSnapshots(bad).size(), 1);
+    std::vector<GameHistory::Move> repeated = { {4}, {0}, {4}, {8} };
+    EXPECT_EQ(GameHistory::positionSnapshots(repeated).size(), 2);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-}
\ No newline at end of file
+}
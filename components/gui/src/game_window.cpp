@@ -9,11 +9,19 @@
 #include <QTimer>
 
 GameWindow::GameWindow(QWidget* parent) : QMainWindow(parent), gameActive(false), gameHistory(nullptr), currentGameId(-1) {
+    aiPollTimer = new QTimer(this);
+    aiPollTimer->setInterval(UIConstants::AITurn::POLL_INTERVAL_MS);
+    connect(aiPollTimer, &QTimer::timeout, this, &GameWindow::checkAIMove);
+
     setupUI();
     // Don't call chooseGameMode here, show setup UI instead
     showGameSetupUI();
 }
 
+GameWindow::~GameWindow() {
+    cancelAIMove(); // Don't keep the pool busy on a search nobody will read
+}
+
 void GameWindow::setupUI() {
     setWindowTitle("Tic-Tac-Toe");
     setStyleSheet("QMainWindow { background-color: #e8eff1; }"); // Slightly cooler background
@@ -99,6 +107,7 @@ void GameWindow::setupUI() {
 
     // Connect logout button
     connect(logoutButton, &QPushButton::clicked, this, [this]() {
+        cancelAIMove();
         emit logoutRequested();
     });
 
@@ -332,6 +341,7 @@ void GameWindow::setupUI() {
 // Add implementations for new slots and helper functions
 
 void GameWindow::showGameSetupUI() {
+    cancelAIMove(); // New Game and reset both come through here
     statusLabel->setText("Choose a game mode:");
     // Reset styles if coming from a finished game
     statusLabel->setStyleSheet(
@@ -510,7 +520,7 @@ void GameWindow::resetGameState() {
 }
 
 // Update the highlightWinningCells method to add animation
-void GameWindow::highlightWinningCells(const std::vector<std::pair<int, int>>& winCells) {
+void GameWindow::highlightWinningCells(const WinInfo& result) {
     QString winningStyle =
         "QPushButton {" // Corrected from qpushbutton
         "    background-color: #58d68d;" // Vibrant green
@@ -518,7 +528,8 @@ void GameWindow::highlightWinningCells(const std::vector<std::pair<int, int>>& w
         "    border: 1px solid #48c97d;" // Matching border
         "}"; // Keep other properties like font, radius from base style
 
-    for (const auto& [row, col] : winCells) {
+    for (int i = 0; i < result.cellCount; ++i) {
+        const auto& [row, col] = result.winCells[i];
         // Combine base style with winning style (ensure font etc. are kept)
         QString currentStyle = cells[row][col]->styleSheet();
         // A simple approach: append winning style specifics. More robust might involve parsing.
@@ -587,7 +598,7 @@ void GameWindow::gameOver(const WinInfo& result) {
     QString specificStyle;
 
     if (result.winner != Player::None) {
-    highlightWinningCells(result.winCells);
+    highlightWinningCells(result);
     if (gameMode == GameMode::PvAI && result.winner == humanPlayer) {
         // Win style (Green) - Player wins against AI
         specificStyle =
@@ -631,6 +642,7 @@ void GameWindow::gameOver(const WinInfo& result) {
 }
 
 void GameWindow::startNewGame() {
+    cancelAIMove();
     // Reset the game board
     board.reset();
     // gameActive will be set after animations potentially
@@ -755,7 +767,7 @@ void GameWindow::startNewGame() {
         if (currentPlayer == aiPlayer) {
             enableBoard(false); // Disable board while AI thinks
             statusLabel->setText("AI (X) is thinking...");
-            QTimer::singleShot(500, this, &GameWindow::makeAIMove);
+            makeAIMove();
         } else {
              enableBoard(true); // Ensure board is enabled if human starts
         }
@@ -824,8 +836,8 @@ void GameWindow::handleCellClick() {
             statusLabel->setText("AI is thinking...");
             enableBoard(false); // Disable board while AI thinks
 
-            // Make AI move after a short delay
-            QTimer::singleShot(500, this, &GameWindow::makeAIMove);
+            // Start the search; the move appears after a short delay
+            makeAIMove();
         }
     }
 }
@@ -835,8 +847,29 @@ void GameWindow::handleCellClick() {
 void GameWindow::makeAIMove() {
     if (!gameActive) return;
 
+    // Search on the pool; checkAIMove picks up the result
+    cancelAIMove();
+    aiSearch = std::make_shared<SearchControl>();
+    aiResult = findBestMoveAsync(aiPool, board, aiPlayer, aiSearch);
+    aiThinkTime.start();
+    aiPollTimer->start();
+}
+
+void GameWindow::checkAIMove() {
+    if (!aiSearch || !gameActive) {
+        cancelAIMove();
+        return;
+    }
+    if (aiResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready ||
+        aiThinkTime.elapsed() < UIConstants::AITurn::MIN_THINK_MS) {
+        return; // Still thinking
+    }
+    aiPollTimer->stop();
+    SearchResult result = aiResult.get();
+    aiSearch.reset();
+
     // Get AI's move
-    auto [row, col] = findBestMove(board, aiPlayer);
+    auto [row, col] = result.move;
 
     // Make the move
     if (board.makeMove(row, col, aiPlayer)) {
@@ -866,6 +899,15 @@ void GameWindow::makeAIMove() {
     }
 }
 
+void GameWindow::cancelAIMove() {
+    aiPollTimer->stop();
+    if (aiSearch) {
+        aiSearch->cancel();
+        aiSearch.reset();
+        aiResult = std::future<SearchResult>(); // The stale result is never read
+    }
+}
+
 void GameWindow::animateCell(QPushButton* cell, const QString& symbol) {
     // First, make the cell invisible using opacity effect
     QGraphicsOpacityEffect* effect = qobject_cast<QGraphicsOpacityEffect*>(cell->graphicsEffect());
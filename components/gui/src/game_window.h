@@ -9,8 +9,12 @@
 #include <QTimer>
 #include <QPropertyAnimation>
 #include <QGraphicsOpacityEffect>
+#include <QElapsedTimer>
+#include <future>
+#include <memory>
 #include "Board.h"
 #include "AI.h"
+#include "Engine.h"
 #include "game_history.h"
 
 // Define game modes
@@ -21,6 +25,7 @@ class GameWindow : public QMainWindow {
 
 public:
     GameWindow(QWidget* parent = nullptr);
+    ~GameWindow() override;
     void setGameHistory(GameHistory* history); // Set the game history instance
     void setCurrentUser(const QString& username); // Set current user for history tracking
 
@@ -52,8 +57,10 @@ private:
     void setupUI();
     void updateBoard();
     void makeAIMove();
+    void checkAIMove(); // Play the AI's move once its search has finished
+    void cancelAIMove(); // Abort the AI search in flight, if any
     void gameOver(const WinInfo& result);
-    void highlightWinningCells(const std::vector<std::pair<int, int>>& cells);
+    void highlightWinningCells(const WinInfo& result);
     void enableBoard(bool enable);
     void animateCell(QPushButton* cell, const QString& symbol);
     void showGameSetupUI(); // Helper to show initial setup
@@ -90,6 +97,13 @@ private:
     Player player1Symbol;
     Player player2Symbol;
     QString m_currentUser; // Current user name for history tracking
+
+    // AI searches run on aiPool so the UI stays responsive
+    QTimer* aiPollTimer;
+    QElapsedTimer aiThinkTime;
+    std::shared_ptr<SearchControl> aiSearch; // Search in flight, null if none
+    std::future<SearchResult> aiResult;
+    ThreadPool aiPool{1};
 };
 
 #endif
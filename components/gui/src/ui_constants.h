@@ -65,6 +65,12 @@ namespace UIConstants {
         static constexpr int HISTORY_BOARD_MARGIN = 8;
     }
     
+    // AI Turn Timing
+    namespace AITurn {
+        static constexpr int MIN_THINK_MS = 500;   // shortest pause before the AI's move appears
+        static constexpr int POLL_INTERVAL_MS = 20; // how often the running search is checked
+    }
+    
     // Replay Controls
     namespace Replay {
         static constexpr int CONTROL_BUTTON_SIZE = 35;
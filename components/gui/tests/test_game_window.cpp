@@ -3,6 +3,7 @@
 #include <QApplication>
 #include <QSignalSpy>
 #include "game_window.h"
+#include "ui_constants.h"
 
 class GameWindowTest : public ::testing::Test {
 public:
@@ -221,3 +222,29 @@ TEST_F(GameWindowTest, ResetGameStateResetsToInitialState) {
     }
     // Symbol buttons might still exist but should not be visible or accessible in reset state
 }
+
+TEST_F(GameWindowTest, ResetCancelsAIMove) {
+    // Start a PvAI game where the AI (X) moves first
+    QList<QPushButton*> buttons = gameWindow->findChildren<QPushButton*>();
+    for (auto* btn : buttons) {
+        if (btn->text() == "Player vs AI") {
+            QTest::mouseClick(btn, Qt::LeftButton);
+            break;
+        }
+    }
+    QPushButton* playOBtn = nullptr;
+    for (auto* btn : gameWindow->findChildren<QPushButton*>()) {
+        if (btn->text() == "Play as O" && btn->isVisibleTo(gameWindow)) playOBtn = btn;
+    }
+    ASSERT_NE(playOBtn, nullptr);
+    QTest::mouseClick(playOBtn, Qt::LeftButton);
+
+    // Reset while the AI is still thinking: its move must never appear
+    gameWindow->resetGameState();
+    QTest::qWait(UIConstants::AITurn::MIN_THINK_MS + 200);
+
+    for (auto* btn : gameWindow->findChildren<QPushButton*>()) {
+        EXPECT_NE(btn->text(), "X");
+        EXPECT_NE(btn->text(), "O");
+    }
+}